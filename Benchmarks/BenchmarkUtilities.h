@@ -0,0 +1,24 @@
+/*
+  ==============================================================================
+
+    BenchmarkUtilities.h
+    Created: 19 Oct 2026 10:31:07am
+    Author:  kyleb
+
+    Helpers shared by the console benchmarks in this folder.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/** Fills a buffer with deterministic noise so every run sees the same signal. */
+inline void fillWithNoise(juce::AudioBuffer<float>& buffer)
+{
+    juce::Random random{ 1234 };
+    for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+        for (int i = 0; i < buffer.getNumSamples(); ++i)
+            buffer.setSample(ch, i, random.nextFloat() * 2.0f - 1.0f);
+}
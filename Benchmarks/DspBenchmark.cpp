@@ -0,0 +1,155 @@
+/*
+  ==============================================================================
+
+    DspBenchmark.cpp
+    Created: 18 Oct 2026 11:02:15am
+    Author:  kyleb
+
+    Console benchmark for the DSP stages. Build it as a JUCE console
+    application that compiles the DSP/ and Service/ sources next to this file.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../DSP/LinearPhaseHighPass.h"
+#include "../DSP/LowCutFilter.h"
+#include "../DSP/LowCutStage.h"
+#include "../DSP/CompressorUnit.h"
+#include "BenchmarkUtilities.h"
+
+namespace
+{
+    constexpr double benchmarkSampleRate = 48000.0;
+    constexpr double secondsOfAudio = 20.0;
+    constexpr int numChannels = 2;
+
+    /**
+        Runs the process callback over secondsOfAudio of input in blocks of blockSize.
+        @param sampleRate Rate the audio is assumed to play back at.
+        @return The processing time as a percentage of real time.
+    */
+    template <typename ProcessFn>
+    double measureRealtimePercent(int blockSize, ProcessFn&& process, double sampleRate = benchmarkSampleRate)
+    {
+        juce::AudioBuffer<float> buffer{ numChannels, blockSize };
+        fillWithNoise(buffer);
+
+        const int numBlocks = int(secondsOfAudio * sampleRate) / blockSize;
+        const auto start = juce::Time::getHighResolutionTicks();
+
+        for (int b = 0; b < numBlocks; ++b)
+        {
+            juce::dsp::AudioBlock<float> block{ buffer };
+            juce::dsp::ProcessContextReplacing<float> ctx{ block };
+            process(ctx);
+        }
+
+        const double elapsed = juce::Time::highResolutionTicksToSeconds(
+            juce::Time::getHighResolutionTicks() - start);
+
+        return 100.0 * elapsed / secondsOfAudio;
+    }
+
+    /**
+        Compares the IIR and linear-phase low cut at typical host block sizes, on their own and
+        inside the LowCutStage the plugin runs, which adds its path selection and fades.
+    */
+    void benchmarkLowCut(juce::TimeSliceThread& thread)
+    {
+        std::cout << "Low cut (% of real time, " << numChannels << " ch @ "
+            << benchmarkSampleRate << " Hz)\n";
+        std::cout << "block\tIIR\tlinear-phase\tstage IIR\tstage linear-phase\n";
+
+        for (int blockSize : { 32, 64, 128, 256, 512, 1024 })
+        {
+            const juce::dsp::ProcessSpec spec{ benchmarkSampleRate, juce::uint32(blockSize), numChannels };
+
+            LowCutFilter iir;
+            iir.prepare(spec);
+            iir.setCutoffFrequency(80.0f);
+
+            ScratchArena arena;
+            arena.prepare(LinearPhaseHighPass::getRequiredScratchBytes());
+
+            LinearPhaseHighPass linearPhase;
+            linearPhase.setCutoffFrequency(80.0f);
+            linearPhase.prepare(spec, thread, arena);
+
+            auto measureStage = [&](bool useLinearPhase)
+            {
+                ScratchArena stageArena;
+                stageArena.prepare(LowCutStage::getRequiredScratchBytes());
+
+                LowCutStage stage;
+                stage.setCutoffFrequency(80.0f);
+                stage.setLinearPhase(useLinearPhase);
+                stage.prepare(spec, thread, stageArena);
+
+                return measureRealtimePercent(blockSize, [&](auto& ctx) { stage.process<numChannels>(ctx); });
+            };
+
+            const double iirPercent = measureRealtimePercent(blockSize,
+                [&](auto& ctx) { iir.process(ctx); });
+            const double linearPercent = measureRealtimePercent(blockSize,
+                [&](auto& ctx) { linearPhase.process(ctx); });
+            const double stageIirPercent = measureStage(false);
+            const double stageLinearPercent = measureStage(true);
+
+            std::cout << blockSize << "\t" << iirPercent << "\t" << linearPercent
+                << "\t" << stageIirPercent << "\t" << stageLinearPercent << "\n";
+        }
+    }
+
+    /**
+        Compares the per-sample and decimated VCA detector at common session rates. The opto stage
+        detects once per block whatever the setting, so it is not part of the comparison.
+    */
+    void benchmarkDetectorDecimation()
+    {
+        constexpr int blockSize = 512;
+
+        std::cout << "\nVCA compressor (% of real time, " << numChannels << " ch, block " << blockSize << ")\n";
+        std::cout << "rate\tfactor\tper-sample\tdecimated\tsaving\n";
+
+        for (double sampleRate : { 44100.0, 48000.0, 96000.0, 192000.0 })
+        {
+            const juce::dsp::ProcessSpec spec{ sampleRate, juce::uint32(blockSize), numChannels };
+            const int factor = CompressorUnit::decimationFactorForSampleRate(sampleRate);
+
+            auto runChain = [&](int decimation)
+            {
+                CompressorUnit vca;
+                vca.prepare(spec);
+                vca.reset();
+                vca.setDecimationFactor(decimation);
+
+                // Fast attack, low threshold: the gain computer runs on every control sample
+                vca.updateCompressorSettings(1.0f, 60.0f, 4.0f, -30.0f);
+
+                return measureRealtimePercent(blockSize, [&](auto& ctx) { vca.processCompression(ctx); }, sampleRate);
+            };
+
+            const double perSample = runChain(1);
+            const double decimated = runChain(factor);
+
+            std::cout << sampleRate << "\t" << factor << "\t" << perSample << "\t" << decimated
+                << "\t" << (perSample > 0.0 ? 100.0 * (1.0 - decimated / perSample) : 0.0) << "%\n";
+        }
+    }
+}
+
+//==============================================================================
+int main()
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    juce::TimeSliceThread thread{ "Benchmark Background" };
+    thread.startThread(juce::Thread::Priority::low);
+
+    benchmarkLowCut(thread);
+    benchmarkDetectorDecimation();
+
+    thread.stopThread(1000);
+    return 0;
+}
@@ -0,0 +1,215 @@
+/*
+  ==============================================================================
+
+    GuiPaintBenchmark.cpp
+    Created: 19 Oct 2026 12:21:06am
+    Author:  kyleb
+
+    Console benchmark for editor paint costs, rendered offscreen into images.
+    Build it as a JUCE console application that compiles all plugin sources
+    next to this file, with the same JucePlugin_* settings as the plugin.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../PluginProcessor.h"
+#include "../PluginEditor.h"
+#include "../GUI/RotaryKnob.h"
+#include "../GUI/LevelMeter.h"
+#include "../GUI/GainReductionMeter.h"
+#include "../GUI/PresetPanel.h"
+#include "../LookAndFeel/RotaryKnobLAF.h"
+
+namespace
+{
+    constexpr int numFrames = 2000;
+    constexpr double frameSeconds = 1.0 / 60.0;
+    constexpr double benchmarkSampleRate = 48000.0;
+    constexpr int blockSize = 512;
+
+    /**
+        Paints a component into an offscreen image numFrames times.
+        @param scale   Physical pixels per logical pixel, e.g. 2 for a HiDPI display.
+        @param prepare Called before every frame, e.g. to change what the component shows.
+        @return Average paint time per frame in microseconds.
+    */
+    template <typename PrepareFn>
+    double measurePaintMicroseconds(juce::Component& component, float scale, PrepareFn&& prepare)
+    {
+        juce::Image image(juce::Image::ARGB,
+            juce::roundToInt((float)component.getWidth() * scale),
+            juce::roundToInt((float)component.getHeight() * scale), true);
+
+        const auto start = juce::Time::getHighResolutionTicks();
+
+        for (int frame = 0; frame < numFrames; ++frame)
+        {
+            prepare(frame);
+
+            juce::Graphics g(image);
+            g.addTransform(juce::AffineTransform::scale(scale));
+            component.paintEntireComponent(g, false);
+        }
+
+        const double elapsed = juce::Time::highResolutionTicksToSeconds(
+            juce::Time::getHighResolutionTicks() - start);
+
+        return 1.0e6 * elapsed / numFrames;
+    }
+
+    /** @return The first component of type T in the tree below parent, or nullptr. */
+    template <typename T>
+    T* findComponent(juce::Component& parent)
+    {
+        for (auto* child : parent.getChildren())
+        {
+            if (auto* match = dynamic_cast<T*>(child))
+                return match;
+
+            if (auto* match = findComponent<T>(*child))
+                return match;
+        }
+
+        return nullptr;
+    }
+
+    /**
+        Deterministic stand-in for the audio thread: pushes blocksPerFrame records into the
+        processor's telemetry ring, with levels and gain reduction that swing slowly with a
+        little jitter, so the meters move every frame.
+    */
+    struct SyntheticTelemetry
+    {
+        static constexpr int blocksPerFrame = 2;
+
+        juce::Random random{ 1234 };
+
+        void feed(int frame, TelemetryRing& ring)
+        {
+            for (int b = 0; b < blocksPerFrame; ++b)
+            {
+                const float phase = ((float)frame + (float)b / (float)blocksPerFrame)
+                    * (float)frameSeconds * juce::MathConstants<float>::twoPi * 0.5f;
+                const float level = 0.5f + 0.45f * std::sin(phase) + 0.05f * random.nextFloat();
+                const float gain = 0.6f + 0.35f * std::cos(phase);
+
+                TelemetryRecord record;
+                record.inputPeak = { level, level * 0.9f };
+                record.inputRms = { level * 0.5f, level * 0.45f };
+                record.compAOutputRms = { level * 0.5f * std::sqrt(gain), level * 0.45f * std::sqrt(gain) };
+                record.compBOutputRms = { level * 0.5f * gain, level * 0.45f * gain };
+                record.outputPeak = { level * gain, level * gain * 0.9f };
+                record.outputRms = record.compBOutputRms;
+                record.gainReduction = { gain, gain * 1.05f };
+                record.compAGainReductionDb = -0.5f * juce::Decibels::gainToDecibels(gain);
+                record.compBGainReductionDb = -0.5f * juce::Decibels::gainToDecibels(gain);
+                record.lowCutHz = 80.0f;
+                record.numSamples = juce::roundToInt(benchmarkSampleRate * frameSeconds) / blocksPerFrame;
+
+                ring.push(record);
+            }
+        }
+    };
+
+    /**
+        Reports the paint time of each measured component of a live editor at 1x and 2x.
+        Each frame goes through the same path as in a host: records are pushed into the
+        processor's telemetry ring and the editor drains them in its frame callback.
+    */
+    void benchmarkEditor(GuideLinesCompAudioProcessor& processor)
+    {
+        std::unique_ptr<juce::AudioProcessorEditor> created{ processor.createEditor() };
+        auto* editor = dynamic_cast<GuideLinesCompAudioProcessorEditor*>(created.get());
+        jassert(editor != nullptr);
+
+        auto* knob = findComponent<RotaryKnob>(*editor);
+        auto* inputMeter = findComponent<LevelMeter>(*editor);
+        auto* gainReductionMeter = findComponent<GainReductionMeter>(*editor);
+        auto* presetPanel = findComponent<Gui::PresetPanel>(*editor);
+
+        SyntheticTelemetry telemetry;
+        auto feed = [&](int frame)
+        {
+            telemetry.feed(frame, processor.getTelemetry());
+            editor->refreshFrame(frameSeconds);
+        };
+
+        std::cout << "Editor paint (us per frame, " << numFrames << " frames)\n";
+        std::cout << "component\t1x\t2x\n";
+
+        auto report = [&](const char* name, juce::Component* component)
+        {
+            if (component == nullptr)
+            {
+                std::cout << name << "\tnot found\n";
+                return;
+            }
+
+            std::cout << name;
+            for (float scale : { 1.0f, 2.0f })
+                std::cout << "\t" << measurePaintMicroseconds(*component, scale, feed);
+            std::cout << "\n";
+        };
+
+        report("RotaryKnob", knob);
+        report("LevelMeter", inputMeter);
+        report("GainReductionMeter", gainReductionMeter);
+        report("PresetPanel", presetPanel);
+        report("Editor", editor);
+    }
+
+    /**
+        Compares a knob with and without the static layer cache while its alert level animates.
+        The two modes run interleaved and the best of several runs is kept, so neither one
+        profits from running second.
+    */
+    void benchmarkRotaryKnob(GuideLinesCompAudioProcessor& processor)
+    {
+        constexpr int numRuns = 5;
+
+        std::cout << "\nRotaryKnob paint (us per frame, best of " << numRuns << " x " << numFrames << " frames)\n";
+        std::cout << "scale\tuncached\tcached\tsaving\n";
+
+        RotaryKnob knob{ "Compress", processor.apvts, compressionParamID };
+        auto* lookAndFeel = RotaryKnobLookAndFeel::get();
+
+        auto animate = [&](int frame) { knob.setAlertLevel((float)(frame % 60) / 60.0f); };
+
+        for (float scale : { 1.0f, 2.0f })
+        {
+            double uncached = std::numeric_limits<double>::max();
+            double cached = std::numeric_limits<double>::max();
+
+            for (int run = 0; run < numRuns; ++run)
+            {
+                lookAndFeel->setLayerCacheEnabled(false);
+                uncached = juce::jmin(uncached, measurePaintMicroseconds(knob, scale, animate));
+
+                // Switching the cache off above emptied it, so this run renders its layers once
+                lookAndFeel->setLayerCacheEnabled(true);
+                cached = juce::jmin(cached, measurePaintMicroseconds(knob, scale, animate));
+            }
+
+            std::cout << scale << "\t" << uncached << "\t" << cached << "\t"
+                << (uncached > 0.0 ? 100.0 * (1.0 - cached / uncached) : 0.0) << "%\n";
+        }
+    }
+}
+
+//==============================================================================
+int main()
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    // Prepared so the editor converts block lengths to time as it would in a host
+    GuideLinesCompAudioProcessor processor;
+    processor.setPlayConfigDetails(2, 2, benchmarkSampleRate, blockSize);
+    processor.prepareToPlay(benchmarkSampleRate, blockSize);
+
+    benchmarkEditor(processor);
+    benchmarkRotaryKnob(processor);
+
+    processor.releaseResources();
+    return 0;
+}
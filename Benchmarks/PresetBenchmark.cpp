@@ -0,0 +1,213 @@
+/*
+  ==============================================================================
+
+    PresetBenchmark.cpp
+    Created: 19 Oct 2026 1:52:18am
+    Author:  kyleb
+
+    Console benchmark for preset file size and load time.
+    Build it as a JUCE console application that compiles all plugin sources
+    next to this file, with the same JucePlugin_* settings as the plugin.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../PluginProcessor.h"
+#include "../Service/PresetFile.h"
+#include "../Service/PresetSearch.h"
+
+namespace
+{
+    constexpr int numPresets = 500;
+    constexpr int numPasses = 5;
+
+    /** Gives every parameter of the processor a random value, like a hand-made preset. */
+    void randomiseParameters(GuideLinesCompAudioProcessor& processor, juce::Random& random)
+    {
+        for (auto* parameter : processor.getParameters())
+            parameter->setValueNotifyingHost(random.nextFloat());
+    }
+
+    /**
+        Loads every file of a library numPasses times.
+        @param load Reads one file and returns the state.
+        @return Average load time per preset in microseconds.
+    */
+    template <typename LoadFn>
+    double measureLoadMicroseconds(const juce::Array<juce::File>& files, LoadFn&& load)
+    {
+        int numValid = 0;
+        const auto start = juce::Time::getHighResolutionTicks();
+
+        for (int pass = 0; pass < numPasses; ++pass)
+            for (const auto& file : files)
+                numValid += load(file).isValid() ? 1 : 0;
+
+        const double elapsed = juce::Time::highResolutionTicksToSeconds(
+            juce::Time::getHighResolutionTicks() - start);
+
+        jassert(numValid == files.size() * numPasses);
+        juce::ignoreUnused(numValid);
+
+        return 1.0e6 * elapsed / (files.size() * numPasses);
+    }
+
+    /** @return The average size of the files in bytes. */
+    double averageSize(const juce::Array<juce::File>& files)
+    {
+        juce::int64 total = 0;
+        for (const auto& file : files)
+            total += file.getSize();
+
+        return files.isEmpty() ? 0.0 : (double)total / files.size();
+    }
+
+    /** Writes the same library as legacy XML and as binary presets and compares loading them. */
+    void benchmarkPresetLoading()
+    {
+        GuideLinesCompAudioProcessor processor;
+        juce::Random random{ 1234 };
+
+        const auto root = juce::File::getSpecialLocation(juce::File::tempDirectory)
+            .getChildFile("GuideLinesCompPresetBenchmark");
+        const auto xmlDirectory = root.getChildFile("xml");
+        const auto binaryDirectory = root.getChildFile("binary");
+        xmlDirectory.createDirectory();
+        binaryDirectory.createDirectory();
+
+        juce::Array<juce::File> xmlFiles, binaryFiles;
+
+        for (int i = 0; i < numPresets; ++i)
+        {
+            randomiseParameters(processor, random);
+            const auto state = processor.apvts.copyState();
+            const auto name = "Preset " + juce::String(i) + "." + Service::PresetManager::extension;
+
+            xmlFiles.add(xmlDirectory.getChildFile(name));
+            state.createXml()->writeTo(xmlFiles.getLast());
+
+            binaryFiles.add(binaryDirectory.getChildFile(name));
+            Service::PresetFile::write(state, binaryFiles.getLast());
+        }
+
+        const double xmlDocument = measureLoadMicroseconds(xmlFiles, [](const juce::File& file)
+        {
+            juce::XmlDocument document{ file };
+            auto xml = document.getDocumentElement();
+            return xml != nullptr ? juce::ValueTree::fromXml(*xml) : juce::ValueTree();
+        });
+
+        const double legacy = measureLoadMicroseconds(xmlFiles, Service::PresetFile::read);
+        const double binary = measureLoadMicroseconds(binaryFiles, Service::PresetFile::read);
+
+        std::cout << "Preset load (" << numPresets << " presets, " << numPasses << " passes)\n";
+        std::cout << "format\tbytes\tus per preset\n";
+        std::cout << "XmlDocument\t" << averageSize(xmlFiles) << "\t" << xmlDocument << "\n";
+        std::cout << "PresetFile (XML)\t" << averageSize(xmlFiles) << "\t" << legacy << "\n";
+        std::cout << "PresetFile (binary)\t" << averageSize(binaryFiles) << "\t" << binary << "\n";
+
+        root.deleteRecursively();
+    }
+
+    /**
+        Builds an in-memory index of numLibraryPresets made-up presets, each named from two words
+        plus a number and carrying one or two tags, like a large third-party library.
+    */
+    std::shared_ptr<const Service::PresetIndex::Snapshot> makeLibrary(int numLibraryPresets, juce::Random& random)
+    {
+        static const juce::StringArray words{ "warm", "glue", "vocal", "drum", "bus", "punch", "smooth",
+            "bright", "dark", "master", "bass", "guitar", "piano", "tight", "wide", "vintage", "gentle", "crush" };
+        static const juce::StringArray tags{ "mix", "master", "vocals", "drums", "bass", "keys", "subtle", "aggressive" };
+
+        auto snapshot = std::make_shared<Service::PresetIndex::Snapshot>();
+        snapshot->names.ensureStorageAllocated(numLibraryPresets);
+        snapshot->tags.reserve((size_t)numLibraryPresets);
+
+        for (int i = 0; i < numLibraryPresets; ++i)
+        {
+            snapshot->names.add(words[random.nextInt(words.size())] + " " + words[random.nextInt(words.size())]
+                + " " + juce::String(i));
+
+            juce::StringArray presetTags{ tags[random.nextInt(tags.size())] };
+            presetTags.addIfNotAlreadyThere(tags[random.nextInt(tags.size())]);
+            snapshot->tags.push_back(presetTags);
+        }
+
+        Service::PresetIndex::buildLookups(*snapshot);
+        return snapshot;
+    }
+
+    /**
+        Runs a query numPasses times on a fresh search, so every pass searches the whole index.
+        @return Average time per query in microseconds.
+    */
+    double measureSearchMicroseconds(const std::shared_ptr<const Service::PresetIndex::Snapshot>& snapshot,
+        const juce::String& query)
+    {
+        double elapsed = 0.0;
+
+        for (int pass = 0; pass < numPasses; ++pass)
+        {
+            Service::PresetSearch search;
+            const auto start = juce::Time::getHighResolutionTicks();
+            search.search(snapshot, query);
+            elapsed += juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - start);
+        }
+
+        return 1.0e6 * elapsed / numPasses;
+    }
+
+    /**
+        Types a query one character at a time into one search, as the browser does.
+        @return Average time per keystroke in microseconds.
+    */
+    double measureTypingMicroseconds(const std::shared_ptr<const Service::PresetIndex::Snapshot>& snapshot,
+        const juce::String& query)
+    {
+        double elapsed = 0.0;
+
+        for (int pass = 0; pass < numPasses; ++pass)
+        {
+            Service::PresetSearch search;
+            const auto start = juce::Time::getHighResolutionTicks();
+
+            for (int length = 1; length <= query.length(); ++length)
+                search.search(snapshot, query.substring(0, length));
+
+            elapsed += juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - start);
+        }
+
+        return 1.0e6 * elapsed / (numPasses * query.length());
+    }
+
+    /** Times exact, fuzzy and typed queries on libraries of 5k and 50k presets. */
+    void benchmarkPresetSearch()
+    {
+        std::cout << "\nPreset search (us per query, " << numPasses << " passes)\n";
+        std::cout << "presets\tprefix\ttwo words\tfuzzy\ttyped per key\n";
+
+        juce::Random random{ 1234 };
+
+        for (int numLibraryPresets : { 5000, 50000 })
+        {
+            const auto snapshot = makeLibrary(numLibraryPresets, random);
+
+            std::cout << numLibraryPresets
+                << "\t" << measureSearchMicroseconds(snapshot, "vin")
+                << "\t" << measureSearchMicroseconds(snapshot, "warm vocals")
+                << "\t" << measureSearchMicroseconds(snapshot, "vintgae")
+                << "\t" << measureTypingMicroseconds(snapshot, "smooth master") << "\n";
+        }
+    }
+}
+
+//==============================================================================
+int main()
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    benchmarkPresetLoading();
+    benchmarkPresetSearch();
+    return 0;
+}
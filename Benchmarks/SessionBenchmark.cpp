@@ -0,0 +1,100 @@
+/*
+  ==============================================================================
+
+    SessionBenchmark.cpp
+    Created: 18 Oct 2026 11:52:40pm
+    Author:  kyleb
+
+    Console benchmark for whole plugin instances in a simulated session.
+    Build it as a JUCE console application that compiles all plugin sources
+    next to this file, with the same JucePlugin_* settings as the plugin.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../PluginProcessor.h"
+#include "BenchmarkUtilities.h"
+
+namespace
+{
+    constexpr double benchmarkSampleRate = 48000.0;
+    constexpr double secondsOfAudio = 10.0;
+    constexpr int blockSize = 256;
+    constexpr int numChannels = 2;
+    constexpr int numInstances = 64;
+
+    /**
+        Runs numInstances processors over secondsOfAudio, one block per instance in turn like a host.
+        @param editorsVisible Whether every instance behaves as if its editor were open.
+        @return The processing time of the whole session as a percentage of real time.
+    */
+    double measureSession(bool editorsVisible)
+    {
+        std::vector<std::unique_ptr<GuideLinesCompAudioProcessor>> instances;
+
+        for (int i = 0; i < numInstances; ++i)
+        {
+            auto processor = std::make_unique<GuideLinesCompAudioProcessor>();
+            processor->setPlayConfigDetails(numChannels, numChannels, benchmarkSampleRate, blockSize);
+            processor->prepareToPlay(benchmarkSampleRate, blockSize);
+            if (editorsVisible)
+                processor->setEditorVisible(true);
+            instances.push_back(std::move(processor));
+        }
+
+        juce::AudioBuffer<float> source{ numChannels, blockSize };
+        fillWithNoise(source);
+
+        juce::AudioBuffer<float> buffer{ numChannels, blockSize };
+        juce::MidiBuffer midi;
+
+        const int numBlocks = int(secondsOfAudio * benchmarkSampleRate) / blockSize;
+        const auto start = juce::Time::getHighResolutionTicks();
+
+        for (int b = 0; b < numBlocks; ++b)
+        {
+            for (auto& processor : instances)
+            {
+                buffer.makeCopyOf(source, true);
+                processor->processBlock(buffer, midi);
+            }
+
+            // Stands in for the editors' timers so the telemetry rings never sit full
+            if (editorsVisible)
+                for (auto& processor : instances)
+                    processor->getTelemetry().discard();
+        }
+
+        const double elapsed = juce::Time::highResolutionTicksToSeconds(
+            juce::Time::getHighResolutionTicks() - start);
+
+        for (auto& processor : instances)
+            processor->releaseResources();
+
+        return 100.0 * elapsed / secondsOfAudio;
+    }
+
+    /** Compares a session with every editor open against one with all editors closed. */
+    void benchmarkEditorVisibility()
+    {
+        std::cout << "Session of " << numInstances << " instances (% of real time, " << numChannels
+            << " ch @ " << benchmarkSampleRate << " Hz, block " << blockSize << ")\n";
+        std::cout << "editors open\teditors closed\tsaving\n";
+
+        const double open = measureSession(true);
+        const double closed = measureSession(false);
+
+        std::cout << open << "\t" << closed << "\t"
+            << (open > 0.0 ? 100.0 * (1.0 - closed / open) : 0.0) << "%\n";
+    }
+}
+
+//==============================================================================
+int main()
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    benchmarkEditorVisibility();
+    return 0;
+}
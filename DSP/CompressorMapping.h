@@ -0,0 +1,63 @@
+/*
+  ==============================================================================
+
+    CompressorMapping.h
+    Created: 18 Oct 2026 11:06:52pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "CompressorUnit.h"
+#include "OptoCompressorUnit.h"
+
+/**
+    Maps the Compression and Control knobs onto the settings of the VCA stage.
+    Shared by the processor and the transfer curve display so both always agree.
+*/
+struct CompressorMapping
+{
+    float inputGainDb = 0.0f;   ///< Drive into the chain, from Compression
+    float attackMs = 60.0f;     ///< VCA attack, from Control
+    float releaseMs = 55.0f;    ///< VCA release, from Control
+    float thresholdDb = -12.0f; ///< VCA threshold, from Control
+    float ratio = 2.0f;         ///< VCA ratio, from Compression
+
+    /**
+        Computes the stage settings for the knob positions.
+        @param compression The Compression parameter (1...100).
+        @param control     The Control parameter (1...100).
+    */
+    static CompressorMapping fromControls(float compression, float control) noexcept
+    {
+        const float controlValue = juce::jlimit(1.0f, 100.0f, control);
+        const float compressValue = juce::jlimit(1.0f, 100.0f, compression);
+
+        const float normCompress = compressValue / 100.0f;
+        const float normControl = controlValue / 100.0f;
+
+        CompressorMapping mapping;
+        mapping.inputGainDb = juce::jmap(normCompress, -3.0f, 12.0f);
+        mapping.attackMs = juce::mapToLog10(normControl, 60.0f, 1.0f);
+        mapping.releaseMs = juce::jmap(controlValue, 0.0f, 100.0f, 55.0f, 100.0f);
+        mapping.thresholdDb = juce::jmap(controlValue, 0.0f, 100.0f, -12.0f, -24.0f);
+        mapping.ratio = juce::jmap(compressValue, 0.0f, 100.0f, 2.0f, 10.0f);
+        return mapping;
+    }
+
+    /**
+        Steady-state level through input gain, VCA stage and opto stage.
+        Ballistics are ignored, so this is the curve for a constant input level.
+        @param inputDb Input level in dBFS.
+        @return Level after the opto stage in dBFS, before the output gain.
+    */
+    float getStaticOutputDb(float inputDb) const noexcept
+    {
+        const float driven = inputDb + inputGainDb;
+        const float afterVca = driven - CompressorUnit::computeGainReductionDb(driven, thresholdDb, ratio);
+        return afterVca - OptoCompressorUnit::computeGainReductionDb(afterVca);
+    }
+};
@@ -13,8 +13,8 @@
 
 void CompressorUnit::prepare(const juce::dsp::ProcessSpec& spec)
 {
-    // Prepare the internal JUCE compressor with the given spec
-    compressor.prepare(spec);
+    jassert(spec.numChannels <= FrameBuffer::maxChannels);
+    sampleRate = spec.sampleRate;
 
     // Set up smoothing for all parameters
     attackSmoothed.reset(spec.sampleRate, smoothingInSeconds);
@@ -31,7 +31,25 @@ void CompressorUnit::prepare(const juce::dsp::ProcessSpec& spec)
 
 void CompressorUnit::reset()
 {
-    compressor.reset();
+    envelope.fill(0.0f);
+    gainState.fill(1.0f);
+}
+
+void CompressorUnit::setDecimationFactor(int factor) noexcept
+{
+    decimationFactor = juce::jlimit(1, maxDecimationFactor, factor);
+}
+
+int CompressorUnit::decimationFactorForSampleRate(double sampleRate) noexcept
+{
+    const int ratio = juce::jlimit(1, maxDecimationFactor, juce::roundToInt(sampleRate / 24000.0));
+
+    // Round down to a power of two so the control spans divide common block sizes
+    int factor = 1;
+    while (factor * 2 <= ratio)
+        factor *= 2;
+
+    return factor;
 }
 
 
@@ -52,14 +70,167 @@ void CompressorUnit::updateCompressorSettings(const float attackMs,
     thresholdSmoothed.setTargetValue(thresholdDb);
 }
 
+void CompressorUnit::applySmoothedSettings() noexcept
+{
+    // Same derivation as juce::dsp::Compressor::update()
+    threshold = juce::Decibels::decibelsToGain(thresholdSmoothed.getNextValue(), -200.0f);
+    thresholdInverse = 1.0f / threshold;
+    ratioInverse = 1.0f / ratioSmoothed.getNextValue();
+
+    attackCoeff = calculateCoefficient(attackSmoothed.getNextValue());
+    releaseCoeff = calculateCoefficient(releaseSmoothed.getNextValue());
+}
+
+float CompressorUnit::calculateCoefficient(float timeMs) const noexcept
+{
+    if (timeMs < 1.0e-3f)
+        return 0.0f;
+
+    const double controlRate = sampleRate / decimationFactor;
+    const double expFactor = -2.0 * juce::MathConstants<double>::pi * 1000.0 / controlRate;
+    return (float)std::exp(expFactor / timeMs);
+}
+
+FrameRegister CompressorUnit::computeGain(FrameRegister envelope) const noexcept
+{
+    const auto one = FrameRegister::expand(1.0f);
+    const auto below = FrameRegister::lessThan(envelope, FrameRegister::expand(threshold));
+
+    // Clamp the overshoot to the range FrameMath::log2 covers; 2^31 is far beyond any real signal
+    const auto overshoot = FrameRegister::min(FrameRegister::max(envelope * FrameRegister::expand(thresholdInverse), one),
+                                              FrameRegister::expand(2147483648.0f));
+
+    // (env / threshold)^(1/ratio - 1) as exp2 of a log2, all lanes at once
+    const auto gain = FrameMath::exp2(FrameMath::log2(overshoot) * FrameRegister::expand(ratioInverse - 1.0f));
+    return (one & below) + (gain & ~below);
+}
+
+template <size_t NumChannels>
+void CompressorUnit::processChannels(juce::dsp::AudioBlock<float>& block, size_t firstChannel) noexcept
+{
+    const size_t numSamples = block.getNumSamples();
+    const size_t factor = (size_t)decimationFactor;
+
+    std::array<float*, NumChannels> data;
+    std::array<float, NumChannels> env, gain, gainStep;
+
+    for (size_t ch = 0; ch < NumChannels; ++ch)
+    {
+        data[ch] = block.getChannelPointer(firstChannel + ch);
+        env[ch] = envelope[firstChannel + ch];
+        gain[ch] = gainState[firstChannel + ch];
+    }
+
+    for (size_t start = 0; start < numSamples; start += factor)
+    {
+        const size_t spanLength = juce::jmin(factor, numSamples - start);
+
+        for (size_t ch = 0; ch < NumChannels; ++ch)
+        {
+            const float* span = data[ch] + start;
+
+            // Peak-preserving decimation: the control sample is the loudest input of the span
+            float level = 0.0f;
+            for (size_t i = 0; i < spanLength; ++i)
+                level = juce::jmax(level, std::abs(span[i]));
+
+            // Peak ballistics detector at the control rate
+            const float cte = level > env[ch] ? attackCoeff : releaseCoeff;
+            env[ch] = level + cte * (env[ch] - level);
+
+            gainStep[ch] = (computeGain(env[ch]) - gain[ch]) / float(spanLength);
+        }
+
+        // Ramp linearly towards the new gain so the audio rate only pays one multiply-add
+        for (size_t i = start; i < start + spanLength; ++i)
+        {
+            for (size_t ch = 0; ch < NumChannels; ++ch)
+            {
+                gain[ch] += gainStep[ch];
+                data[ch][i] *= gain[ch];
+            }
+        }
+    }
+
+    for (size_t ch = 0; ch < NumChannels; ++ch)
+    {
+        envelope[firstChannel + ch] = env[ch];
+        gainState[firstChannel + ch] = gain[ch];
+    }
+}
+
+template <size_t NumChannels>
 void CompressorUnit::processCompression(juce::dsp::ProcessContextReplacing<float>& context)
 {
-    // Apply smoothed values to the compressor
-    compressor.setAttack(attackSmoothed.getNextValue());
-    compressor.setRelease(releaseSmoothed.getNextValue());
-    compressor.setRatio(ratioSmoothed.getNextValue());
-    compressor.setThreshold(thresholdSmoothed.getNextValue());
-
-    // Process the incoming audio block
-    compressor.process(context);
+    applySmoothedSettings();
+
+    auto& block = context.getOutputBlock();
+
+    if constexpr (NumChannels == 0)
+    {
+        const size_t numChannels = juce::jmin(block.getNumChannels(), envelope.size());
+
+        for (size_t ch = 0; ch < numChannels; ++ch)
+            processChannels<1>(block, ch);
+    }
+    else
+    {
+        jassert(block.getNumChannels() == NumChannels);
+        processChannels<NumChannels>(block, 0);
+    }
+}
+
+template void CompressorUnit::processCompression<0>(juce::dsp::ProcessContextReplacing<float>&);
+template void CompressorUnit::processCompression<1>(juce::dsp::ProcessContextReplacing<float>&);
+template void CompressorUnit::processCompression<2>(juce::dsp::ProcessContextReplacing<float>&);
+
+void CompressorUnit::processFrames(FrameRegister* frames, size_t numFrames, size_t numChannels) noexcept
+{
+    applySmoothedSettings();
+
+    numChannels = juce::jmin(numChannels, envelope.size());
+
+    const auto attack = FrameRegister::expand(attackCoeff);
+    const auto release = FrameRegister::expand(releaseCoeff);
+
+    const size_t factor = (size_t)decimationFactor;
+
+    auto env = FrameRegister::expand(0.0f);
+    auto gain = FrameRegister::expand(1.0f);
+    for (size_t ch = 0; ch < numChannels; ++ch)
+    {
+        env.set(ch, envelope[ch]);
+        gain.set(ch, gainState[ch]);
+    }
+
+    for (size_t start = 0; start < numFrames; start += factor)
+    {
+        const size_t spanLength = juce::jmin(factor, numFrames - start);
+        FrameRegister* span = frames + start;
+
+        // Peak-preserving decimation for every lane in one go
+        auto level = FrameRegister::expand(0.0f);
+        for (size_t i = 0; i < spanLength; ++i)
+            level = FrameRegister::max(level, FrameRegister::abs(span[i]));
+
+        // Peak ballistics at the control rate
+        const auto rising = FrameRegister::greaterThan(level, env);
+        const auto cte = (attack & rising) + (release & ~rising);
+        env = level + cte * (env - level);
+
+        // Gain computer for every lane in one go
+        const auto target = computeGain(env);
+        const auto gainStep = (target - gain) * FrameRegister::expand(1.0f / float(spanLength));
+        for (size_t i = 0; i < spanLength; ++i)
+        {
+            gain += gainStep;
+            span[i] = span[i] * gain;
+        }
+    }
+
+    for (size_t ch = 0; ch < numChannels; ++ch)
+    {
+        envelope[ch] = env.get(ch);
+        gainState[ch] = gain.get(ch);
+    }
 }
@@ -10,10 +10,13 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include <array>
+#include "FrameProcessing.h"
 
 /**
     A basic VCA-style compressor unit controlled via attack, release, threshold, and ratio parameters.
-    This class encapsulates a JUCE `dsp::Compressor` and adds smoothed parameter updates.
+    The detector and gain computer reproduce `juce::dsp::Compressor` (peak ballistics, hard knee),
+    with the envelope kept per lane so planar blocks and interleaved frames share one state.
     It is typically controlled using mapped values from a UI control scheme such as "control" and "compress" knobs.
 */
 class CompressorUnit
@@ -51,15 +54,101 @@ public:
     /**
         Applies compression to the given audio buffer.
         This retrieves the next smoothed values for each parameter and applies the compressor to the audio block.
+        @tparam NumChannels Channel count of the block (1 or 2), or 0 to take it from the block.
         @param context A JUCE `ProcessContextReplacing` object representing the audio block to process.
     */
+    template <size_t NumChannels = 0>
     void processCompression(juce::dsp::ProcessContextReplacing<float>& context);
 
+    /**
+        Applies compression to interleaved frames, running the detector for all lanes at once.
+        @param frames      Frames to process in place.
+        @param numFrames   Number of frames.
+        @param numChannels Number of lanes carrying a channel.
+    */
+    void processFrames(FrameRegister* frames, size_t numFrames, size_t numChannels) noexcept;
+
+    /**
+        Runs the detector and gain computer once every `factor` samples.
+        Each control sample is the peak of its span, so transients are not lost, and the gain is
+        linearly interpolated back to the audio rate. A factor of 1 is the plain per-sample detector.
+        @param factor Decimation factor, clamped to 1...maxDecimationFactor.
+    */
+    void setDecimationFactor(int factor) noexcept;
+
+    /**
+        Picks the decimation factor that brings the control rate closest to 24 kHz, rounded down
+        to a power of two.
+        @param sampleRate The audio sample rate.
+        @return 2 at 44.1/48 kHz, 4 at 88.2/96/176.4 kHz, 8 at 192 kHz.
+    */
+    static int decimationFactorForSampleRate(double sampleRate) noexcept;
+
+    static constexpr int maxDecimationFactor = 8;   ///< Upper bound for setDecimationFactor()
+
+    /**
+        Static curve of the gain computer in the log domain, equivalent to computeGain().
+        @param levelDb     Detector level in dBFS.
+        @param thresholdDb Threshold in dBFS.
+        @param ratio       Compression ratio.
+        @return The gain reduction in dB (positive).
+    */
+    static float computeGainReductionDb(float levelDb, float thresholdDb, float ratio) noexcept
+    {
+        return levelDb > thresholdDb ? (levelDb - thresholdDb) * (1.0f - 1.0f / ratio) : 0.0f;
+    }
+
 private:
-    juce::dsp::Compressor<float> compressor;
+    /**
+        Advances the parameter smoothers by one block and refreshes the detector coefficients.
+    */
+    void applySmoothedSettings() noexcept;
+
+    /**
+        Runs detector and gain for NumChannels adjacent channels in one loop over the control spans.
+        @param block        The planar block.
+        @param firstChannel Index of the first channel to process.
+    */
+    template <size_t NumChannels>
+    void processChannels(juce::dsp::AudioBlock<float>& block, size_t firstChannel) noexcept;
+
+    /**
+        Static gain computer.
+        @param envelope The detector level (linear).
+        @return The linear gain to apply.
+    */
+    float computeGain(float envelope) const noexcept
+    {
+        return envelope < threshold ? 1.0f : std::pow(envelope * thresholdInverse, ratioInverse - 1.0f);
+    }
+
+    /**
+        Static gain computer for all lanes of a frame at once, using FrameMath instead of std::pow.
+        @param envelope The detector level per lane (linear).
+        @return The linear gain per lane, within 2e-5 dB of computeGain().
+    */
+    FrameRegister computeGain(FrameRegister envelope) const noexcept;
+
+    /**
+        Converts a ballistics time into a one-pole coefficient, as `juce::dsp::BallisticsFilter` does.
+        The coefficient is computed for the control rate, i.e. the sample rate divided by the decimation factor.
+        @param timeMs The attack or release time in milliseconds.
+    */
+    float calculateCoefficient(float timeMs) const noexcept;
 
     const double smoothingInSeconds = 0.01; ///< Smoothing time constant for parameter transitions.
 
+    double sampleRate = 44100.0;
+    int decimationFactor = 1;               ///< Audio samples per control sample
+    float threshold = 1.0f;                 ///< Linear threshold
+    float thresholdInverse = 1.0f;          ///< 1 / threshold
+    float ratioInverse = 1.0f;              ///< 1 / ratio
+    float attackCoeff = 0.0f;               ///< Envelope coefficient while rising
+    float releaseCoeff = 0.0f;              ///< Envelope coefficient while falling
+
+    std::array<float, FrameBuffer::maxChannels> envelope{}; ///< Detector state per channel / lane
+    std::array<float, FrameBuffer::maxChannels> gainState{}; ///< Last applied gain per channel / lane
+
     juce::LinearSmoothedValue<float> attackSmoothed;
     juce::LinearSmoothedValue<float> releaseSmoothed;
     juce::LinearSmoothedValue<float> ratioSmoothed;
@@ -0,0 +1,226 @@
+/*
+  ==============================================================================
+
+    FrameProcessing.h
+    Created: 18 Oct 2026 1:24:05pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "ScratchArena.h"
+
+/// One SIMD register holds one sample frame: lane N carries channel N.
+using FrameRegister = juce::dsp::SIMDRegister<float>;
+
+/**
+    Interleaved storage for the frame chain.
+    Planar channel data is packed into one SIMD register per sample at the start of a block,
+    processed frame by frame by every stage, and unpacked once at the end. Lanes that do not
+    carry a channel are kept at zero so per-lane sums stay valid.
+*/
+class FrameBuffer
+{
+public:
+    /// Number of channels that fit into one frame.
+    static constexpr size_t maxChannels = FrameRegister::size();
+
+    /**
+        Returns the arena space prepare() will carve.
+        @param maxFrames The largest block that will be packed.
+    */
+    static size_t getRequiredBytes(int maxFrames) noexcept
+    {
+        return ScratchArena::bytesFor<FrameRegister>((size_t)maxFrames);
+    }
+
+    /**
+        Carves space for the given number of frames from the arena.
+        @param arena     The prepared scratch arena.
+        @param maxFrames The largest block that will be packed.
+    */
+    void prepare(ScratchArena& arena, int maxFrames)
+    {
+        frames = arena.allocate<FrameRegister>((size_t)maxFrames);
+        capacity = frames != nullptr ? (size_t)maxFrames : 0;
+        numFrames = 0;
+        numChannels = 0;
+    }
+
+    /**
+        Checks whether a planar block fits into the prepared storage.
+        @param channels Number of planar channels.
+        @param samples  Number of samples per channel.
+    */
+    bool canHold(size_t channels, size_t samples) const noexcept
+    {
+        return channels <= maxChannels && samples <= capacity;
+    }
+
+    /**
+        Interleaves a planar block into frames, applying a gain on the way in.
+        @param block The planar source block.
+        @param gain  Linear gain applied while packing.
+    */
+    void pack(const juce::dsp::AudioBlock<float>& block, float gain) noexcept
+    {
+        numFrames = block.getNumSamples();
+        numChannels = block.getNumChannels();
+        jassert(canHold(numChannels, numFrames));
+
+        float* raw = getRawData();
+
+        for (size_t ch = 0; ch < maxChannels; ++ch)
+        {
+            if (ch < numChannels)
+            {
+                const float* source = block.getChannelPointer(ch);
+                for (size_t i = 0; i < numFrames; ++i)
+                    raw[i * maxChannels + ch] = source[i] * gain;
+            }
+            else
+            {
+                for (size_t i = 0; i < numFrames; ++i)
+                    raw[i * maxChannels + ch] = 0.0f;
+            }
+        }
+    }
+
+    /**
+        De-interleaves the processed frames back into a planar block.
+        @param block The planar destination block, same size as the packed one.
+    */
+    void unpack(juce::dsp::AudioBlock<float>& block) const noexcept
+    {
+        jassert(block.getNumSamples() == numFrames && block.getNumChannels() == numChannels);
+
+        const float* raw = getRawData();
+
+        for (size_t ch = 0; ch < numChannels; ++ch)
+        {
+            float* destination = block.getChannelPointer(ch);
+            for (size_t i = 0; i < numFrames; ++i)
+                destination[i] = raw[i * maxChannels + ch];
+        }
+    }
+
+    /// @returns The packed frames.
+    FrameRegister* getFrames() noexcept { return frames; }
+
+    /// @returns Number of frames currently packed.
+    size_t getNumFrames() const noexcept { return numFrames; }
+
+    /// @returns Number of lanes carrying a channel.
+    size_t getNumChannels() const noexcept { return numChannels; }
+
+private:
+    float* getRawData() const noexcept { return reinterpret_cast<float*>(frames); }
+
+    FrameRegister* frames = nullptr;                   ///< Carved from the scratch arena
+    size_t capacity = 0;                               ///< Frames available at frames
+    size_t numFrames = 0;
+    size_t numChannels = 0;
+};
+
+/**
+    Per-lane level accumulators for one pass over a frame block.
+    Replaces per-sample atomic updates: the sums live in registers and are published once per block.
+*/
+struct FrameLevels
+{
+    FrameRegister sumOfSquares = FrameRegister::expand(0.0f);   ///< Per-lane sum of x^2
+    FrameRegister peak = FrameRegister::expand(0.0f);           ///< Per-lane max |x|
+
+    /**
+        Accumulates squares and, optionally, peaks of a frame block.
+        @param frames      Frames to measure.
+        @param numFrames   Number of frames.
+        @param includePeak True to track the per-lane absolute peak as well.
+    */
+    void measure(const FrameRegister* frames, size_t numFrames, bool includePeak) noexcept
+    {
+        auto squares = sumOfSquares;
+        auto maxAbs = peak;
+
+        for (size_t i = 0; i < numFrames; ++i)
+        {
+            const auto x = frames[i];
+            squares += x * x;
+
+            if (includePeak)
+                maxAbs = FrameRegister::max(maxAbs, FrameRegister::abs(x));
+        }
+
+        sumOfSquares = squares;
+        peak = maxAbs;
+    }
+};
+
+/**
+    Lane-wise log2 / exp2 for the frame chain, so per-lane curves such as the compressor's gain
+    computer stay in registers instead of falling back to one std::pow per lane.
+    Both split the argument into an integer part with five compare-and-scale steps and evaluate a
+    polynomial on the remaining unit interval, which keeps them within a few 1e-6 of std::log2 /
+    std::exp2 over the ranges below.
+*/
+struct FrameMath
+{
+    /**
+        @param x Lane values in [1, 2^32).
+        @return log2(x) per lane.
+    */
+    static FrameRegister log2(FrameRegister x) noexcept
+    {
+        const auto one = FrameRegister::expand(1.0f);
+        auto exponent = FrameRegister::expand(0.0f);
+
+        for (int shift = 16; shift > 0; shift /= 2)
+        {
+            const auto above = FrameRegister::greaterThanOrEqual(x, FrameRegister::expand(float(1u << shift)));
+            x = x * ((FrameRegister::expand(1.0f / float(1u << shift)) & above) + (one & ~above));
+            exponent += FrameRegister::expand(float(shift)) & above;
+        }
+
+        // log2(1 + m) = m * P(m) on [0, 1), exact at m = 0
+        const auto m = x - one;
+        auto p = FrameRegister::expand(0.0204903208f);
+        p = p * m + FrameRegister::expand(-0.0960661725f);
+        p = p * m + FrameRegister::expand(0.215588445f);
+        p = p * m + FrameRegister::expand(-0.339247727f);
+        p = p * m + FrameRegister::expand(0.47770592f);
+        p = p * m + FrameRegister::expand(-0.721162733f);
+        p = p * m + FrameRegister::expand(1.44269326f);
+
+        return exponent + p * m;
+    }
+
+    /**
+        @param x Lane values in [-32, 0].
+        @return 2^x per lane.
+    */
+    static FrameRegister exp2(FrameRegister x) noexcept
+    {
+        const auto one = FrameRegister::expand(1.0f);
+        auto scale = one;
+
+        for (int shift = 16; shift > 0; shift /= 2)
+        {
+            const auto below = FrameRegister::lessThanOrEqual(x, FrameRegister::expand(-float(shift)));
+            x += FrameRegister::expand(float(shift)) & below;
+            scale = scale * ((FrameRegister::expand(1.0f / float(1u << shift)) & below) + (one & ~below));
+        }
+
+        // 2^f on [-1, 0]
+        auto p = FrameRegister::expand(0.000947555376f);
+        p = p * x + FrameRegister::expand(0.00921087996f);
+        p = p * x + FrameRegister::expand(0.0552996111f);
+        p = p * x + FrameRegister::expand(0.240179491f);
+        p = p * x + FrameRegister::expand(0.693143202f);
+        p = p * x + FrameRegister::expand(0.999999945f);
+
+        return scale * p;
+    }
+};
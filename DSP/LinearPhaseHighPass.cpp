@@ -0,0 +1,269 @@
+/*
+  ==============================================================================
+
+    LinearPhaseHighPass.cpp
+    Created: 18 Oct 2026 9:12:40am
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "LinearPhaseHighPass.h"
+
+//==============================================================================
+LinearPhaseHighPass::~LinearPhaseHighPass()
+{
+    if (thread != nullptr)
+        thread->removeTimeSliceClient(this);
+}
+
+//==============================================================================
+size_t LinearPhaseHighPass::getRequiredScratchBytes() noexcept
+{
+    return ScratchArena::bytesFor<float>(2 * fftSize)
+        + ScratchArena::bytesFor<float>(partitionSize)
+        + ScratchArena::bytesFor<std::complex<float>>(numBins);
+}
+
+void LinearPhaseHighPass::prepare(const juce::dsp::ProcessSpec& spec, juce::TimeSliceThread& designThread, ScratchArena& arena)
+{
+    // Stop the designer while the partition layout changes
+    if (thread != nullptr)
+        thread->removeTimeSliceClient(this);
+
+    thread = &designThread;
+    sampleRate = spec.sampleRate;
+
+    // Odd tap count so the group delay is a whole number of samples
+    kernelLength = juce::jmax(3, juce::roundToInt(sampleRate * kernelLengthSeconds)) | 1;
+    numPartitions = (kernelLength + partitionSize - 1) / partitionSize;
+
+    window.assign((size_t)kernelLength, 0.0f);
+    juce::dsp::WindowingFunction<float>::fillWindowingTables(window.data(), window.size(),
+        juce::dsp::WindowingFunction<float>::blackman, false);
+
+    const size_t spectrumSize = (size_t)(numPartitions * numBins);
+    for (auto& slot : kernelSlots)
+        slot.assign(spectrumSize, {});
+
+    channels.resize(spec.numChannels);
+    for (auto& state : channels)
+    {
+        state.inputFifo.assign(partitionSize, 0.0f);
+        state.outputFifo.assign(partitionSize, 0.0f);
+        state.history.assign(fftSize, 0.0f);
+        state.delayLine.assign(spectrumSize, {});
+    }
+
+    designerScratch.assign(2 * fftSize, 0.0f);
+
+    fftScratch = arena.allocate<float>(2 * fftSize);
+    fadeScratch = arena.allocate<float>(partitionSize);
+    accumulator = arena.allocate<std::complex<float>>(numBins);
+
+    // Design the first kernel here so the audio thread never runs without one
+    readSlot = 0;
+    writeSlot = 2;
+    sharedSlot.store(1);
+    designedCutoff = requestedCutoff.load();
+    designKernel(designedCutoff, kernelSlots[(size_t)readSlot], designerFft, designerScratch);
+
+    reset();
+
+    thread->addTimeSliceClient(this);
+}
+
+void LinearPhaseHighPass::reset() noexcept
+{
+    for (auto& state : channels)
+    {
+        std::fill(state.inputFifo.begin(), state.inputFifo.end(), 0.0f);
+        std::fill(state.outputFifo.begin(), state.outputFifo.end(), 0.0f);
+        std::fill(state.history.begin(), state.history.end(), 0.0f);
+        std::fill(state.delayLine.begin(), state.delayLine.end(), std::complex<float>{});
+    }
+
+    fifoPosition = 0;
+    delayLinePosition = 0;
+}
+
+void LinearPhaseHighPass::setCutoffFrequency(float newCutoffHz) noexcept
+{
+    requestedCutoff.store(newCutoffHz, std::memory_order_relaxed);
+}
+
+//==============================================================================
+void LinearPhaseHighPass::process(const juce::dsp::ProcessContextReplacing<float>& context) noexcept
+{
+    auto& block = context.getOutputBlock();
+    const int numChannels = juce::jmin((int)block.getNumChannels(), (int)channels.size());
+    const int numSamples = (int)block.getNumSamples();
+
+    numActiveChannels = (size_t)numChannels;
+    int position = 0;
+
+    while (position < numSamples)
+    {
+        const int numToCopy = juce::jmin(numSamples - position, partitionSize - fifoPosition);
+
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            auto& state = channels[(size_t)ch];
+            float* data = block.getChannelPointer((size_t)ch) + position;
+
+            // Swap the incoming samples with the already filtered previous partition
+            for (int i = 0; i < numToCopy; ++i)
+            {
+                const float input = data[i];
+                data[i] = state.outputFifo[(size_t)(fifoPosition + i)];
+                state.inputFifo[(size_t)(fifoPosition + i)] = input;
+            }
+        }
+
+        fifoPosition += numToCopy;
+        position += numToCopy;
+
+        if (fifoPosition == partitionSize)
+        {
+            processPartition();
+            fifoPosition = 0;
+        }
+    }
+}
+
+void LinearPhaseHighPass::processPartition() noexcept
+{
+    // Push the newest input frame of every channel into its frequency-domain delay line
+    delayLinePosition = (delayLinePosition + 1) % numPartitions;
+
+    for (size_t ch = 0; ch < numActiveChannels; ++ch)
+    {
+        auto& state = channels[ch];
+        std::copy(state.history.begin() + partitionSize, state.history.end(), state.history.begin());
+        std::copy(state.inputFifo.begin(), state.inputFifo.end(), state.history.begin() + partitionSize);
+
+        std::copy(state.history.begin(), state.history.end(), fftScratch);
+        std::fill(fftScratch + fftSize, fftScratch + 2 * fftSize, 0.0f);
+        fft.performRealOnlyForwardTransform(fftScratch, true);
+
+        const auto* bins = reinterpret_cast<const std::complex<float>*>(fftScratch);
+        std::copy(bins, bins + numBins, state.delayLine.begin() + delayLinePosition * numBins);
+    }
+
+    // Convolve with the current kernel; an outgoing kernel is only read before the exchange
+    const bool kernelChanged = (sharedSlot.load(std::memory_order_acquire) & freshKernelFlag) != 0;
+
+    for (size_t ch = 0; ch < numActiveChannels; ++ch)
+        convolve(channels[ch], kernelSlots[(size_t)readSlot], channels[ch].outputFifo.data());
+
+    if (!kernelChanged)
+        return;
+
+    readSlot = sharedSlot.exchange(readSlot, std::memory_order_acq_rel) & slotIndexMask;
+
+    // Linear crossfade from the old kernel's output to the new one across this partition
+    const float fadeStep = 1.0f / float(partitionSize);
+
+    for (size_t ch = 0; ch < numActiveChannels; ++ch)
+    {
+        auto& state = channels[ch];
+        convolve(state, kernelSlots[(size_t)readSlot], fadeScratch);
+
+        for (int i = 0; i < partitionSize; ++i)
+        {
+            const float fade = float(i) * fadeStep;
+            float& out = state.outputFifo[(size_t)i];
+            out += (fadeScratch[i] - out) * fade;
+        }
+    }
+}
+
+void LinearPhaseHighPass::convolve(const ChannelState& state, const Spectrum& kernel, float* output) noexcept
+{
+    std::fill(accumulator, accumulator + numBins, std::complex<float>{});
+
+    float* acc = reinterpret_cast<float*>(accumulator);
+
+    for (int p = 0; p < numPartitions; ++p)
+    {
+        // Partition p of the kernel pairs with the input frame from p partitions ago
+        const int slot = (delayLinePosition - p + numPartitions) % numPartitions;
+        const float* x = reinterpret_cast<const float*>(state.delayLine.data() + slot * numBins);
+        const float* h = reinterpret_cast<const float*>(kernel.data() + p * numBins);
+
+        for (int k = 0; k < 2 * numBins; k += 2)
+        {
+            acc[k] += x[k] * h[k] - x[k + 1] * h[k + 1];
+            acc[k + 1] += x[k] * h[k + 1] + x[k + 1] * h[k];
+        }
+    }
+
+    std::copy(acc, acc + 2 * numBins, fftScratch);
+    std::fill(fftScratch + 2 * numBins, fftScratch + 2 * fftSize, 0.0f);
+    fft.performRealOnlyInverseTransform(fftScratch);
+
+    // Overlap-save: only the second half of the circular result is alias free
+    std::copy(fftScratch + partitionSize, fftScratch + fftSize, output);
+}
+
+//==============================================================================
+int LinearPhaseHighPass::useTimeSlice()
+{
+    const float cutoff = requestedCutoff.load(std::memory_order_relaxed);
+
+    if (cutoff != designedCutoff)
+    {
+        designKernel(cutoff, kernelSlots[(size_t)writeSlot], designerFft, designerScratch);
+        designedCutoff = cutoff;
+
+        writeSlot = sharedSlot.exchange(writeSlot | freshKernelFlag, std::memory_order_acq_rel) & slotIndexMask;
+    }
+
+    return designIntervalMs;
+}
+
+void LinearPhaseHighPass::designKernel(float cutoffHz, Spectrum& destination,
+    const juce::dsp::FFT& designFft, std::vector<float>& scratch) const
+{
+    const double fc = juce::jlimit(1.0, sampleRate * 0.45, (double)cutoffHz) / sampleRate;
+    const int centre = (kernelLength - 1) / 2;
+
+    // Windowed-sinc low-pass, normalised to unity DC gain
+    std::vector<double> lowPass((size_t)kernelLength);
+    double dcGain = 0.0;
+
+    for (int n = 0; n < kernelLength; ++n)
+    {
+        const double x = double(n - centre);
+        const double sinc = (n == centre)
+            ? 2.0 * fc
+            : std::sin(juce::MathConstants<double>::twoPi * fc * x) / (juce::MathConstants<double>::pi * x);
+
+        lowPass[(size_t)n] = sinc * window[(size_t)n];
+        dcGain += lowPass[(size_t)n];
+    }
+
+    // Spectral inversion turns the low-pass into the matching high-pass
+    for (int p = 0; p < numPartitions; ++p)
+    {
+        std::fill(scratch.begin(), scratch.end(), 0.0f);
+
+        for (int i = 0; i < partitionSize; ++i)
+        {
+            const int n = p * partitionSize + i;
+            if (n >= kernelLength)
+                break;
+
+            double tap = -lowPass[(size_t)n] / dcGain;
+            if (n == centre)
+                tap += 1.0;
+
+            scratch[(size_t)i] = float(tap);
+        }
+
+        designFft.performRealOnlyForwardTransform(scratch.data(), true);
+
+        const auto* bins = reinterpret_cast<const std::complex<float>*>(scratch.data());
+        std::copy(bins, bins + numBins, destination.begin() + p * numBins);
+    }
+}
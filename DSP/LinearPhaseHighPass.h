@@ -0,0 +1,159 @@
+/*
+  ==============================================================================
+
+    LinearPhaseHighPass.h
+    Created: 18 Oct 2026 9:12:40am
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include <complex>
+#include <vector>
+#include "ScratchArena.h"
+
+/**
+    Linear-phase high-pass filter built on a uniformly partitioned overlap-save convolver.
+    The windowed-sinc kernel is designed on a background TimeSliceThread whenever the cutoff
+    changes, and handed to the audio thread through a lock-free triple buffer. Kernel swaps
+    are crossfaded over one partition so cutoff moves do not click.
+    The filter delays the signal by one partition plus half the kernel length; see getLatencySamples().
+*/
+class LinearPhaseHighPass : private juce::TimeSliceClient
+{
+public:
+    /// Constructs an unprepared filter. Call prepare() before processing.
+    LinearPhaseHighPass() = default;
+
+    /// Detaches the kernel designer from its background thread.
+    ~LinearPhaseHighPass() override;
+
+    /**
+        Returns the arena space prepare() carves for the audio-thread FFT scratch.
+    */
+    static size_t getRequiredScratchBytes() noexcept;
+
+    /**
+        Allocates all partitions and delay lines for the given spec, designs the initial kernel
+        synchronously, and registers the kernel designer with the background thread.
+        Must not be called concurrently with process().
+        @param spec         The JUCE DSP process specification (sample rate, block size, channels).
+        @param designThread The background thread used to regenerate kernels.
+        @param arena        The prepared scratch arena; see getRequiredScratchBytes().
+    */
+    void prepare(const juce::dsp::ProcessSpec& spec, juce::TimeSliceThread& designThread, ScratchArena& arena);
+
+    /**
+        Clears the FIFOs and the frequency-domain delay line without touching the kernel.
+    */
+    void reset() noexcept;
+
+    /**
+        Requests a new cutoff frequency. Real-time safe: only stores the request,
+        the kernel is rebuilt on the background thread.
+        @param newCutoffHz The new -6 dB cutoff in Hz.
+    */
+    void setCutoffFrequency(float newCutoffHz) noexcept;
+
+    /**
+        Filters the block in place. Only the channels of the block are convolved,
+        so a one-channel block skips the work for the others.
+        @param context A JUCE processing context containing the audio block.
+    */
+    void process(const juce::dsp::ProcessContextReplacing<float>& context) noexcept;
+
+    /**
+        Returns the total delay introduced by the filter: the partition FIFO plus the
+        group delay of the symmetric kernel.
+        @return The latency in samples.
+    */
+    int getLatencySamples() const noexcept { return partitionSize + (kernelLength - 1) / 2; }
+
+    static constexpr int fftOrder = 9;                          ///< FFT order of one partition pair
+    static constexpr int fftSize = 1 << fftOrder;               ///< 2 * partitionSize
+    static constexpr int partitionSize = fftSize / 2;           ///< Samples per uniform partition
+    static constexpr int numBins = partitionSize + 1;           ///< Non-negative frequency bins
+    static constexpr double kernelLengthSeconds = 0.085;        ///< Kernel length, scaled with sample rate
+
+private:
+    using Spectrum = std::vector<std::complex<float>>;
+
+    /// Per-channel overlap-save state.
+    struct ChannelState
+    {
+        std::vector<float> inputFifo;     ///< Incoming samples for the current partition
+        std::vector<float> outputFifo;    ///< Filtered samples of the previous partition
+        std::vector<float> history;       ///< Last two partitions of input (overlap-save frame)
+        Spectrum delayLine;               ///< Frequency-domain delay line, numPartitions * numBins
+    };
+
+    //==============================================================================
+    /// Background kernel designer; rebuilds the kernel when the requested cutoff moved.
+    int useTimeSlice() override;
+
+    /**
+        Designs a Blackman-windowed sinc high-pass and stores its partition spectra.
+        @param cutoffHz    The cutoff in Hz.
+        @param destination Spectrum buffer receiving numPartitions * numBins bins.
+        @param designFft   The FFT engine owned by the calling thread.
+        @param scratch     Time-domain scratch of 2 * fftSize floats.
+    */
+    void designKernel(float cutoffHz, Spectrum& destination,
+        const juce::dsp::FFT& designFft, std::vector<float>& scratch) const;
+
+    /// Runs one partition of overlap-save convolution on every channel.
+    void processPartition() noexcept;
+
+    /**
+        Multiplies the delay line of one channel with a kernel and inverse-transforms the sum.
+        @param state   The channel state.
+        @param kernel  Kernel spectra to convolve with.
+        @param output  Receives partitionSize output samples.
+    */
+    void convolve(const ChannelState& state, const Spectrum& kernel, float* output) noexcept;
+
+    //==============================================================================
+    juce::dsp::FFT fft{ fftOrder };                 ///< Audio-thread FFT engine
+    juce::dsp::FFT designerFft{ fftOrder };         ///< Background-thread FFT engine
+
+    juce::TimeSliceThread* thread = nullptr;        ///< Thread running the kernel designer
+
+    double sampleRate = 44100.0;
+    int kernelLength = 1;                           ///< Odd number of taps
+    int numPartitions = 1;
+
+    std::vector<float> window;                      ///< Blackman window of kernelLength taps
+    std::vector<float> designerScratch;             ///< Background FFT scratch
+
+    std::vector<ChannelState> channels;
+    size_t numActiveChannels = 0;                   ///< Channels of the block being processed
+    float* fftScratch = nullptr;                    ///< Audio-thread FFT scratch, 2 * fftSize floats (arena)
+    float* fadeScratch = nullptr;                   ///< New-kernel output during a crossfade (arena)
+    std::complex<float>* accumulator = nullptr;     ///< Complex multiply-accumulate target, numBins (arena)
+
+    int fifoPosition = 0;                           ///< Write position inside the current partition
+    int delayLinePosition = 0;                      ///< Newest slot of the frequency-domain delay line
+
+    //==============================================================================
+    // Lock-free triple buffer for kernel spectra: the designer owns writeSlot, the audio
+    // thread owns readSlot, and the third slot is exchanged through sharedSlot.
+    static constexpr int slotIndexMask = 0x3;
+    static constexpr int freshKernelFlag = 0x4;
+
+    std::array<Spectrum, 3> kernelSlots;
+    std::atomic<int> sharedSlot{ 1 };
+    int readSlot = 0;                               ///< Audio thread only
+    int writeSlot = 2;                              ///< Designer only
+
+    std::atomic<float> requestedCutoff{ 20.0f };    ///< Written by the audio thread
+    float designedCutoff = -1.0f;                   ///< Designer only
+
+    static constexpr int designIntervalMs = 20;     ///< Polling interval of the designer
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LinearPhaseHighPass)
+};
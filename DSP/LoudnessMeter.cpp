@@ -0,0 +1,327 @@
+/*
+  ==============================================================================
+
+    LoudnessMeter.cpp
+    Created: 18 Oct 2026 6:03:18pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "LoudnessMeter.h"
+
+//==============================================================================
+LoudnessMeter::~LoudnessMeter()
+{
+    if (thread != nullptr)
+        thread->removeTimeSliceClient(this);
+}
+
+void LoudnessMeter::prepare(const juce::dsp::ProcessSpec& spec, juce::TimeSliceThread& statsThread)
+{
+    if (thread != nullptr)
+        thread->removeTimeSliceClient(this);
+
+    thread = &statsThread;
+
+    const double fs = spec.sampleRate;
+    const double pi = juce::MathConstants<double>::pi;
+
+    // BS.1770 K-weighting re-derived for any sample rate (the standard only tabulates 48 kHz)
+    {
+        const double f0 = 1681.974450955533;
+        const double gainDb = 3.999843853973347;
+        const double q = 0.7071752369554196;
+
+        const double k = std::tan(pi * f0 / fs);
+        const double vh = std::pow(10.0, gainDb / 20.0);
+        const double vb = std::pow(vh, 0.4996667741545416);
+        const double a0 = 1.0 + k / q + k * k;
+
+        shelf.b0 = float((vh + vb * k / q + k * k) / a0);
+        shelf.b1 = float(2.0 * (k * k - vh) / a0);
+        shelf.b2 = float((vh - vb * k / q + k * k) / a0);
+        shelf.a1 = float(2.0 * (k * k - 1.0) / a0);
+        shelf.a2 = float((1.0 - k / q + k * k) / a0);
+    }
+
+    {
+        const double f0 = 38.13547087602444;
+        const double q = 0.5003270373238773;
+
+        const double k = std::tan(pi * f0 / fs);
+        const double a0 = 1.0 + k / q + k * k;
+
+        highPass.b0 = 1.0f;
+        highPass.b1 = -2.0f;
+        highPass.b2 = 1.0f;
+        highPass.a1 = float(2.0 * (k * k - 1.0) / a0);
+        highPass.a2 = float((1.0 - k / q + k * k) / a0);
+    }
+
+    blockLength = juce::jmax(1, juce::roundToInt(fs * blockSeconds));
+
+    // Nothing is running yet, so the background state can be cleared directly
+    fifo.reset();
+    recentBlocks.fill(0.0);
+    recentPosition = 0;
+    numBlocksSeen = 0;
+    gatingBlocks.clear();
+    shortTermValues.clear();
+    resetRequested.store(false);
+
+    momentary.store(silenceLufs);
+    shortTerm.store(silenceLufs);
+    integrated.store(silenceLufs);
+    loudnessRange.store(0.0f);
+
+    shelf.reset();
+    highPass.reset();
+    blockSum = FrameRegister::expand(0.0f);
+    blockPosition = 0;
+
+    thread->addTimeSliceClient(this);
+}
+
+void LoudnessMeter::reset() noexcept
+{
+    shelf.reset();
+    highPass.reset();
+    blockSum = FrameRegister::expand(0.0f);
+    blockPosition = 0;
+
+    resetRequested.store(true, std::memory_order_release);
+}
+
+//==============================================================================
+void LoudnessMeter::process(const juce::AudioBuffer<float>& buffer) noexcept
+{
+    const int numChannels = juce::jmin(buffer.getNumChannels(), 2);
+    const int numSamples = buffer.getNumSamples();
+
+    if (numChannels == 0)
+        return;
+
+    const float* left = buffer.getReadPointer(0);
+    const float* right = buffer.getReadPointer(numChannels - 1);
+
+    // A mono output counts once; both channels carry a weight of 1.0 in BS.1770
+    const bool isMono = numChannels == 1;
+
+    auto sum = blockSum;
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        auto x = FrameRegister::expand(0.0f);
+        x.set(0, left[i]);
+        if (!isMono)
+            x.set(1, right[i]);
+
+        const auto y = highPass.process(shelf.process(x));
+        sum += y * y;
+
+        if (++blockPosition == blockLength)
+        {
+            // Lanes beyond the measured channels stay at zero, so the lane sum is the weighted sum
+            const float energy = sum.sum() / float(blockLength);
+
+            int start1, size1, start2, size2;
+            fifo.prepareToWrite(1, start1, size1, start2, size2);
+            if (size1 > 0)
+            {
+                fifoData[(size_t)start1] = energy;
+                fifo.finishedWrite(1);
+            }
+
+            sum = FrameRegister::expand(0.0f);
+            blockPosition = 0;
+        }
+    }
+
+    blockSum = sum;
+}
+
+//==============================================================================
+int LoudnessMeter::useTimeSlice()
+{
+    if (resetRequested.exchange(false, std::memory_order_acq_rel))
+    {
+        // Blocks queued before the reset belong to the old measurement
+        int start1, size1, start2, size2;
+        const int numReady = fifo.getNumReady();
+        fifo.prepareToRead(numReady, start1, size1, start2, size2);
+        fifo.finishedRead(size1 + size2);
+
+        recentBlocks.fill(0.0);
+        recentPosition = 0;
+        numBlocksSeen = 0;
+        gatingBlocks.clear();
+        shortTermValues.clear();
+
+        momentary.store(silenceLufs, std::memory_order_relaxed);
+        shortTerm.store(silenceLufs, std::memory_order_relaxed);
+        integrated.store(silenceLufs, std::memory_order_relaxed);
+        loudnessRange.store(0.0f, std::memory_order_relaxed);
+    }
+
+    const int numReady = fifo.getNumReady();
+    if (numReady == 0)
+        return pollIntervalMs;
+
+    int start1, size1, start2, size2;
+    fifo.prepareToRead(numReady, start1, size1, start2, size2);
+
+    for (int i = 0; i < size1; ++i)
+        addBlock(fifoData[(size_t)(start1 + i)]);
+    for (int i = 0; i < size2; ++i)
+        addBlock(fifoData[(size_t)(start2 + i)]);
+
+    fifo.finishedRead(size1 + size2);
+
+    momentary.store(energyToLufs(windowEnergy(momentaryBlocks)), std::memory_order_relaxed);
+    shortTerm.store(energyToLufs(windowEnergy(shortTermBlocks)), std::memory_order_relaxed);
+    integrated.store(computeIntegrated(), std::memory_order_relaxed);
+    loudnessRange.store(computeRange(), std::memory_order_relaxed);
+
+    return pollIntervalMs;
+}
+
+void LoudnessMeter::addBlock(float energy) noexcept
+{
+    recentBlocks[(size_t)recentPosition] = energy;
+    recentPosition = (recentPosition + 1) % shortTermBlocks;
+    ++numBlocksSeen;
+
+    // Gating blocks are 400 ms long and overlap by 75 %, i.e. one per 100 ms sub-block
+    if (numBlocksSeen >= momentaryBlocks)
+        gatingBlocks.add(windowEnergy(momentaryBlocks));
+
+    // LRA uses 3 s windows at the same 10 Hz rate
+    if (numBlocksSeen >= shortTermBlocks)
+        shortTermValues.add(windowEnergy(shortTermBlocks));
+}
+
+double LoudnessMeter::windowEnergy(int numBlocks) const noexcept
+{
+    const int available = juce::jmin(numBlocks, numBlocksSeen);
+    if (available == 0)
+        return 0.0;
+
+    double sum = 0.0;
+    for (int i = 1; i <= available; ++i)
+        sum += recentBlocks[(size_t)((recentPosition - i + shortTermBlocks) % shortTermBlocks)];
+
+    // Before a window has filled, average over what exists so the readout starts immediately
+    return sum / available;
+}
+
+float LoudnessMeter::computeIntegrated() const noexcept
+{
+    juce::uint64 count = 0;
+    double energy = 0.0;
+
+    for (int bin = 0; bin < Histogram::numBins; ++bin)
+    {
+        count += gatingBlocks.counts[(size_t)bin];
+        energy += gatingBlocks.energies[(size_t)bin];
+    }
+
+    if (count == 0)
+        return silenceLufs;
+
+    const float relativeGate = energyToLufs(energy / (double)count) - 10.0f;
+
+    count = 0;
+    energy = 0.0;
+
+    for (int bin = Histogram::binFor(relativeGate); bin < Histogram::numBins; ++bin)
+    {
+        count += gatingBlocks.counts[(size_t)bin];
+        energy += gatingBlocks.energies[(size_t)bin];
+    }
+
+    return count > 0 ? energyToLufs(energy / (double)count) : silenceLufs;
+}
+
+float LoudnessMeter::computeRange() const noexcept
+{
+    juce::uint64 count = 0;
+    double energy = 0.0;
+
+    for (int bin = 0; bin < Histogram::numBins; ++bin)
+    {
+        count += shortTermValues.counts[(size_t)bin];
+        energy += shortTermValues.energies[(size_t)bin];
+    }
+
+    if (count == 0)
+        return 0.0f;
+
+    const int firstBin = Histogram::binFor(energyToLufs(energy / (double)count) - 20.0f);
+
+    juce::uint64 gatedCount = 0;
+    for (int bin = firstBin; bin < Histogram::numBins; ++bin)
+        gatedCount += shortTermValues.counts[(size_t)bin];
+
+    if (gatedCount == 0)
+        return 0.0f;
+
+    // Walk the cumulative distribution to the 10th and 95th percentiles
+    const auto lowTarget = juce::uint64(std::ceil(0.10 * double(gatedCount)));
+    const auto highTarget = juce::uint64(std::ceil(0.95 * double(gatedCount)));
+
+    juce::uint64 cumulative = 0;
+    float low = 0.0f;
+    float high = 0.0f;
+    bool lowFound = false;
+
+    for (int bin = firstBin; bin < Histogram::numBins; ++bin)
+    {
+        cumulative += shortTermValues.counts[(size_t)bin];
+
+        if (!lowFound && cumulative >= lowTarget)
+        {
+            low = Histogram::lowerEdge(bin);
+            lowFound = true;
+        }
+
+        if (cumulative >= highTarget)
+        {
+            high = Histogram::lowerEdge(bin);
+            break;
+        }
+    }
+
+    return juce::jmax(0.0f, high - low);
+}
+
+//==============================================================================
+void LoudnessMeter::Histogram::add(double energy) noexcept
+{
+    const float lufs = energyToLufs(energy);
+    if (lufs < silenceLufs)
+        return;
+
+    const int bin = binFor(lufs);
+    ++counts[(size_t)bin];
+    energies[(size_t)bin] += energy;
+}
+
+void LoudnessMeter::Histogram::clear() noexcept
+{
+    counts.fill(0);
+    energies.fill(0.0);
+}
+
+int LoudnessMeter::Histogram::binFor(float lufs) noexcept
+{
+    return juce::jlimit(0, numBins - 1, int((lufs - silenceLufs) / binWidth));
+}
+
+float LoudnessMeter::energyToLufs(double energy) noexcept
+{
+    if (energy <= 0.0)
+        return silenceLufs;
+
+    return juce::jmax(silenceLufs, float(-0.691 + 10.0 * std::log10(energy)));
+}
@@ -0,0 +1,161 @@
+/*
+  ==============================================================================
+
+    LoudnessMeter.h
+    Created: 18 Oct 2026 6:03:18pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include "FrameProcessing.h"
+
+/**
+    ITU-R BS.1770 / EBU R128 loudness meter: momentary, short-term, integrated loudness and LRA.
+    The audio thread only runs the K-weighting biquads (all channels in one SIMD register) and
+    sums the weighted energy of each 100 ms block. Those sums go through a lock-free FIFO to a
+    TimeSliceClient on a background thread, which does the windowing, gating and LRA statistics
+    and publishes the results as atomics. The meter runs whether or not an editor is open.
+*/
+class LoudnessMeter : private juce::TimeSliceClient
+{
+public:
+    /// Constructs an unprepared meter. Call prepare() before processing.
+    LoudnessMeter() = default;
+
+    /// Detaches the statistics from the background thread.
+    ~LoudnessMeter() override;
+
+    /**
+        Computes the K-weighting coefficients for the sample rate, clears all statistics and
+        registers the meter with the background thread. Must not be called concurrently with process().
+        @param spec         The JUCE DSP process specification (sample rate, block size, channels).
+        @param statsThread  The background thread that evaluates the gating blocks.
+    */
+    void prepare(const juce::dsp::ProcessSpec& spec, juce::TimeSliceThread& statsThread);
+
+    /**
+        Restarts the measurement: clears the filters on the calling (audio) thread and asks the
+        background thread to drop its history and histograms.
+    */
+    void reset() noexcept;
+
+    /**
+        Measures a block of output. Real-time safe.
+        @param buffer The final output; only the first two channels are measured.
+    */
+    void process(const juce::AudioBuffer<float>& buffer) noexcept;
+
+    /// @returns Momentary loudness (400 ms) in LUFS.
+    float getMomentaryLoudness() const noexcept { return momentary.load(std::memory_order_relaxed); }
+
+    /// @returns Short-term loudness (3 s) in LUFS.
+    float getShortTermLoudness() const noexcept { return shortTerm.load(std::memory_order_relaxed); }
+
+    /// @returns Gated integrated loudness since the last reset in LUFS.
+    float getIntegratedLoudness() const noexcept { return integrated.load(std::memory_order_relaxed); }
+
+    /// @returns Loudness range since the last reset in LU.
+    float getLoudnessRange() const noexcept { return loudnessRange.load(std::memory_order_relaxed); }
+
+    static constexpr float silenceLufs = -70.0f;           ///< Absolute gate, also shown for silence
+    static constexpr double blockSeconds = 0.1;            ///< Length of one gating sub-block
+    static constexpr int momentaryBlocks = 4;              ///< 400 ms window
+    static constexpr int shortTermBlocks = 30;             ///< 3 s window
+
+private:
+    /// Biquad in transposed direct form II, one lane per channel.
+    struct Biquad
+    {
+        float b0 = 1.0f, b1 = 0.0f, b2 = 0.0f, a1 = 0.0f, a2 = 0.0f;
+        FrameRegister z1 = FrameRegister::expand(0.0f);
+        FrameRegister z2 = FrameRegister::expand(0.0f);
+
+        FrameRegister process(FrameRegister x) noexcept
+        {
+            const auto y = x * FrameRegister::expand(b0) + z1;
+            z1 = x * FrameRegister::expand(b1) - y * FrameRegister::expand(a1) + z2;
+            z2 = x * FrameRegister::expand(b2) - y * FrameRegister::expand(a2);
+            return y;
+        }
+
+        void reset() noexcept
+        {
+            z1 = FrameRegister::expand(0.0f);
+            z2 = FrameRegister::expand(0.0f);
+        }
+    };
+
+    /**
+        Loudness histogram in 0.1 LU bins from the absolute gate up to +5 LUFS.
+        Keeps the energy per bin as well, so gated means are exact and not bin-quantised.
+    */
+    struct Histogram
+    {
+        static constexpr int numBins = 750;
+        static constexpr float binWidth = 0.1f;
+
+        std::array<juce::uint32, numBins> counts{};
+        std::array<double, numBins> energies{};
+
+        void add(double energy) noexcept;
+        void clear() noexcept;
+        static int binFor(float lufs) noexcept;
+        static float lowerEdge(int bin) noexcept { return silenceLufs + bin * binWidth; }
+    };
+
+    //==============================================================================
+    /// Background side: drains the FIFO and refreshes all published values.
+    int useTimeSlice() override;
+
+    /// Adds one 100 ms block to the sliding windows and histograms.
+    void addBlock(float energy) noexcept;
+
+    /// Gated integrated loudness (-70 LUFS absolute, -10 LU relative).
+    float computeIntegrated() const noexcept;
+
+    /// Loudness range (-70 LUFS absolute, -20 LU relative, 10th to 95th percentile).
+    float computeRange() const noexcept;
+
+    /// Mean energy of the newest numBlocks sub-blocks.
+    double windowEnergy(int numBlocks) const noexcept;
+
+    static float energyToLufs(double energy) noexcept;
+
+    //==============================================================================
+    // Audio thread
+    Biquad shelf;                           ///< Stage 1: high-frequency shelf
+    Biquad highPass;                        ///< Stage 2: RLB high-pass
+    FrameRegister blockSum = FrameRegister::expand(0.0f);   ///< Per-lane K-weighted energy of the running block
+    int blockLength = 4410;                 ///< Samples per 100 ms block
+    int blockPosition = 0;
+
+    static constexpr int fifoSize = 128;
+    juce::AbstractFifo fifo{ fifoSize };
+    std::array<float, fifoSize> fifoData{};
+
+    // Background thread
+    juce::TimeSliceThread* thread = nullptr;
+    std::array<double, shortTermBlocks> recentBlocks{};    ///< Ring of the newest block energies
+    int recentPosition = 0;
+    int numBlocksSeen = 0;
+    Histogram gatingBlocks;                 ///< 400 ms blocks for the integrated loudness
+    Histogram shortTermValues;              ///< 3 s windows for the loudness range
+
+    std::atomic<bool> resetRequested{ false };
+
+    // Published results
+    std::atomic<float> momentary{ silenceLufs };
+    std::atomic<float> shortTerm{ silenceLufs };
+    std::atomic<float> integrated{ silenceLufs };
+    std::atomic<float> loudnessRange{ 0.0f };
+
+    static constexpr int pollIntervalMs = 50;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LoudnessMeter)
+};
@@ -0,0 +1,125 @@
+/*
+  ==============================================================================
+
+    LowCutFilter.cpp
+    Created: 18 Oct 2026 1:40:52pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "LowCutFilter.h"
+
+//==============================================================================
+void LowCutFilter::prepare(const juce::dsp::ProcessSpec& spec)
+{
+    jassert(spec.numChannels <= FrameBuffer::maxChannels);
+
+    sampleRate = spec.sampleRate;
+    updateCoefficients();
+    reset();
+}
+
+void LowCutFilter::reset() noexcept
+{
+    s1 = FrameRegister::expand(0.0f);
+    s2 = FrameRegister::expand(0.0f);
+}
+
+void LowCutFilter::setCutoffFrequency(float newCutoffHz) noexcept
+{
+    cutoffFrequency = newCutoffHz;
+    updateCoefficients();
+}
+
+void LowCutFilter::updateCoefficients() noexcept
+{
+    g = (float)std::tan(juce::MathConstants<double>::pi * cutoffFrequency / sampleRate);
+    h = 1.0f / (1.0f + R2 * g + g * g);
+}
+
+//==============================================================================
+template <size_t NumChannels>
+void LowCutFilter::processChannels(juce::dsp::AudioBlock<float>& block, size_t firstChannel) noexcept
+{
+    const size_t numSamples = block.getNumSamples();
+
+    std::array<float*, NumChannels> data;
+    std::array<float, NumChannels> ls1, ls2;
+
+    for (size_t ch = 0; ch < NumChannels; ++ch)
+    {
+        data[ch] = block.getChannelPointer(firstChannel + ch);
+        ls1[ch] = s1.get(firstChannel + ch);
+        ls2[ch] = s2.get(firstChannel + ch);
+    }
+
+    for (size_t i = 0; i < numSamples; ++i)
+    {
+        for (size_t ch = 0; ch < NumChannels; ++ch)
+        {
+            const float yHP = h * (data[ch][i] - ls1[ch] * (g + R2) - ls2[ch]);
+            const float yBP = yHP * g + ls1[ch];
+            ls1[ch] = yHP * g + yBP;
+
+            const float yLP = yBP * g + ls2[ch];
+            ls2[ch] = yBP * g + yLP;
+
+            data[ch][i] = yHP;
+        }
+    }
+
+    for (size_t ch = 0; ch < NumChannels; ++ch)
+    {
+        s1.set(firstChannel + ch, ls1[ch]);
+        s2.set(firstChannel + ch, ls2[ch]);
+    }
+}
+
+template <size_t NumChannels>
+void LowCutFilter::process(const juce::dsp::ProcessContextReplacing<float>& context) noexcept
+{
+    auto& block = context.getOutputBlock();
+
+    if constexpr (NumChannels == 0)
+    {
+        const size_t numChannels = juce::jmin(block.getNumChannels(), FrameBuffer::maxChannels);
+
+        for (size_t ch = 0; ch < numChannels; ++ch)
+            processChannels<1>(block, ch);
+    }
+    else
+    {
+        jassert(block.getNumChannels() == NumChannels);
+        processChannels<NumChannels>(block, 0);
+    }
+}
+
+template void LowCutFilter::process<0>(const juce::dsp::ProcessContextReplacing<float>&) noexcept;
+template void LowCutFilter::process<1>(const juce::dsp::ProcessContextReplacing<float>&) noexcept;
+template void LowCutFilter::process<2>(const juce::dsp::ProcessContextReplacing<float>&) noexcept;
+
+void LowCutFilter::processFrames(FrameRegister* frames, size_t numFrames) noexcept
+{
+    const auto gv = FrameRegister::expand(g);
+    const auto hv = FrameRegister::expand(h);
+    const auto feedback = FrameRegister::expand(g + R2);
+
+    auto ls1 = s1;
+    auto ls2 = s2;
+
+    for (size_t i = 0; i < numFrames; ++i)
+    {
+        const auto yHP = hv * (frames[i] - ls1 * feedback - ls2);
+        const auto yBP = yHP * gv + ls1;
+        ls1 = yHP * gv + yBP;
+
+        const auto yLP = yBP * gv + ls2;
+        ls2 = yBP * gv + yLP;
+
+        frames[i] = yHP;
+    }
+
+    s1 = ls1;
+    s2 = ls2;
+}
@@ -0,0 +1,85 @@
+/*
+  ==============================================================================
+
+    LowCutFilter.h
+    Created: 18 Oct 2026 1:40:52pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include "FrameProcessing.h"
+
+/**
+    Second-order Butterworth high-pass in topology-preserving-transform state-variable form.
+    Matches `juce::dsp::StateVariableTPTFilter` in highpass mode, but keeps its state per lane so
+    the planar chain and the interleaved frame chain can hand the same filter back and forth
+    without a discontinuity.
+*/
+class LowCutFilter
+{
+public:
+    /// Constructs a default low cut at 20 Hz.
+    LowCutFilter() = default;
+
+    /**
+        Prepares the filter for playback.
+        @param spec The JUCE DSP process specification (sample rate, block size, channels).
+    */
+    void prepare(const juce::dsp::ProcessSpec& spec);
+
+    /**
+        Clears the integrator states of every lane.
+    */
+    void reset() noexcept;
+
+    /**
+        Sets the cutoff frequency and recomputes the coefficients.
+        @param newCutoffHz The -3 dB cutoff in Hz.
+    */
+    void setCutoffFrequency(float newCutoffHz) noexcept;
+
+    /**
+        Filters a planar block in place.
+        With a fixed channel count all channels run through one sample loop, so the compiler can
+        unroll the channel loop and interleave the independent recursions.
+        @tparam NumChannels Channel count of the block (1 or 2), or 0 to take it from the block.
+        @param context A JUCE processing context containing the audio block.
+    */
+    template <size_t NumChannels = 0>
+    void process(const juce::dsp::ProcessContextReplacing<float>& context) noexcept;
+
+    /**
+        Filters interleaved frames in place, all lanes at once.
+        @param frames    Frames to filter.
+        @param numFrames Number of frames.
+    */
+    void processFrames(FrameRegister* frames, size_t numFrames) noexcept;
+
+private:
+    void updateCoefficients() noexcept;
+
+    /**
+        Filters NumChannels adjacent channels of a planar block in one sample loop.
+        @param block        The planar block.
+        @param firstChannel Index of the first channel to filter.
+    */
+    template <size_t NumChannels>
+    void processChannels(juce::dsp::AudioBlock<float>& block, size_t firstChannel) noexcept;
+
+    double sampleRate = 44100.0;
+    float cutoffFrequency = 20.0f;
+
+    float g = 0.0f;                                        ///< Pre-warped integrator gain
+    float h = 1.0f;                                        ///< Feedback normalisation
+    static constexpr float R2 = juce::MathConstants<float>::sqrt2;   ///< Damping for a Butterworth response
+
+    FrameRegister s1 = FrameRegister::expand(0.0f);        ///< First integrator state, one lane per channel
+    FrameRegister s2 = FrameRegister::expand(0.0f);        ///< Second integrator state, one lane per channel
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LowCutFilter)
+};
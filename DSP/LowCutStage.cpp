@@ -0,0 +1,154 @@
+/*
+  ==============================================================================
+
+    LowCutStage.cpp
+    Created: 19 Oct 2026 10:14:22am
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "LowCutStage.h"
+
+//==============================================================================
+size_t LowCutStage::getRequiredScratchBytes() noexcept
+{
+    return LinearPhaseHighPass::getRequiredScratchBytes();
+}
+
+void LowCutStage::prepare(const juce::dsp::ProcessSpec& spec, juce::TimeSliceThread& designThread, ScratchArena& arena)
+{
+    iir.prepare(spec);
+    linearPhase.prepare(spec, designThread, arena);
+
+    fadeStep = 1.0f / (float)juce::jmax(1, juce::roundToInt(spec.sampleRate * fadeSeconds));
+
+    // The IIR tail is short next to the fade; the FIR output trails its input by up to twice its delay
+    iirRingOutSamples = juce::roundToInt(spec.sampleRate * fadeSeconds);
+    firRingOutSamples = 2 * linearPhase.getLatencySamples();
+
+    reset();
+}
+
+void LowCutStage::reset() noexcept
+{
+    iir.reset();
+    linearPhase.reset();
+
+    // Both paths start from silence, so the selected one can be heard straight away
+    linearPhaseActive = useLinearPhase;
+    fade = Fade::none;
+    fadeGain = 1.0f;
+    ringOutRemaining = 0;
+}
+
+void LowCutStage::setCutoffFrequency(float newCutoffHz) noexcept
+{
+    iir.setCutoffFrequency(newCutoffHz);
+    linearPhase.setCutoffFrequency(newCutoffHz);
+}
+
+void LowCutStage::setLinearPhase(bool shouldUseLinearPhase) noexcept
+{
+    useLinearPhase = shouldUseLinearPhase;
+}
+
+//==============================================================================
+template <size_t NumChannels>
+void LowCutStage::process(const juce::dsp::ProcessContextReplacing<float>& context) noexcept
+{
+    auto& block = context.getOutputBlock();
+    const size_t numChannels = NumChannels > 0 ? NumChannels : block.getNumChannels();
+
+    bool switchNow = false;
+
+    if (fade != Fade::none || useLinearPhase != linearPhaseActive)
+        switchNow = applyFade(block, numChannels);
+
+    if (linearPhaseActive)
+        linearPhase.process(context);
+    else
+        iir.process<NumChannels>(context);
+
+    if (switchNow)
+        switchPath();
+}
+
+template void LowCutStage::process<0>(const juce::dsp::ProcessContextReplacing<float>&) noexcept;
+template void LowCutStage::process<1>(const juce::dsp::ProcessContextReplacing<float>&) noexcept;
+template void LowCutStage::process<2>(const juce::dsp::ProcessContextReplacing<float>&) noexcept;
+
+void LowCutStage::processFrames(FrameRegister* frames, size_t numFrames) noexcept
+{
+    jassert(canProcessFrames());
+
+    iir.processFrames(frames, numFrames);
+}
+
+//==============================================================================
+/**
+    Runs the fade state machine over one block. The gain goes on the input, so the filter
+    itself smooths every step and the delayed FIR output fades as well.
+    - out: fades to silence, then feeds silence until the running path has rung out
+    - in: fades up again on the new path, or on the old one if the request was taken back
+*/
+bool LowCutStage::applyFade(juce::dsp::AudioBlock<float>& block, size_t numChannels) noexcept
+{
+    const size_t numSamples = block.getNumSamples();
+
+    if (fade == Fade::none)
+        fade = Fade::out;
+
+    for (size_t i = 0; i < numSamples; ++i)
+    {
+        const bool wantsChange = useLinearPhase != linearPhaseActive;
+
+        switch (fade)
+        {
+            case Fade::out:
+                if (!wantsChange)
+                    fade = Fade::in;
+                else if ((fadeGain = juce::jmax(0.0f, fadeGain - fadeStep)) == 0.0f)
+                {
+                    fade = Fade::ringOut;
+                    ringOutRemaining = linearPhaseActive ? firRingOutSamples : iirRingOutSamples;
+                }
+                break;
+
+            case Fade::ringOut:
+                if (!wantsChange)
+                    fade = Fade::in;
+                else if (ringOutRemaining > 0)
+                    --ringOutRemaining;
+                break;
+
+            case Fade::in:
+                if (wantsChange)
+                    fade = Fade::out;
+                else if ((fadeGain = juce::jmin(1.0f, fadeGain + fadeStep)) == 1.0f)
+                    fade = Fade::none;
+                break;
+
+            case Fade::none:
+                break;
+        }
+
+        for (size_t ch = 0; ch < numChannels; ++ch)
+            block.getChannelPointer(ch)[i] *= fadeGain;
+    }
+
+    // The path only changes between blocks; the rest of this one is silence either way
+    return fade == Fade::ringOut && ringOutRemaining == 0;
+}
+
+void LowCutStage::switchPath() noexcept
+{
+    linearPhaseActive = useLinearPhase;
+
+    if (linearPhaseActive)
+        linearPhase.reset();
+    else
+        iir.reset();
+
+    fade = Fade::in;
+}
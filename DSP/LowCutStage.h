@@ -0,0 +1,116 @@
+/*
+  ==============================================================================
+
+    LowCutStage.h
+    Created: 19 Oct 2026 10:14:22am
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "FrameProcessing.h"
+#include "LinearPhaseHighPass.h"
+#include "LowCutFilter.h"
+#include "ScratchArena.h"
+
+/**
+    The low cut of the chain: the IIR LowCutFilter or the LinearPhaseHighPass.
+    Only the selected path runs, and the IIR path adds no delay, so the chain has no latency unless
+    linear phase is engaged. A path change fades the input out, lets the old path ring out, restarts
+    the new path and fades the input back in, so the switch never clicks. The owner reports the
+    latency of the requested path to the host; see getLatencySamples().
+*/
+class LowCutStage
+{
+public:
+    /// Constructs an unprepared stage. Call prepare() before processing.
+    LowCutStage() = default;
+
+    /**
+        Returns the arena space prepare() carves for the FIR.
+    */
+    static size_t getRequiredScratchBytes() noexcept;
+
+    /**
+        Prepares both filters and starts on the path selected with setLinearPhase() without a fade.
+        @param spec         The JUCE DSP process specification (sample rate, block size, channels).
+        @param designThread The background thread used to regenerate the FIR kernels.
+        @param arena        The prepared scratch arena; see getRequiredScratchBytes().
+    */
+    void prepare(const juce::dsp::ProcessSpec& spec, juce::TimeSliceThread& designThread, ScratchArena& arena);
+
+    /**
+        Clears both filters and finishes any running path change.
+    */
+    void reset() noexcept;
+
+    /**
+        Sets the cutoff of both filters.
+        @param newCutoffHz The cutoff in Hz.
+    */
+    void setCutoffFrequency(float newCutoffHz) noexcept;
+
+    /**
+        Selects the path to be heard. A change starts on the next processed block.
+        @param shouldUseLinearPhase True for the linear-phase FIR, false for the IIR filter.
+    */
+    void setLinearPhase(bool shouldUseLinearPhase) noexcept;
+
+    /**
+        Filters a planar block in place.
+        @tparam NumChannels Channel count of the block (1 or 2), or 0 to take it from the block.
+        @param context A JUCE processing context containing the audio block.
+    */
+    template <size_t NumChannels = 0>
+    void process(const juce::dsp::ProcessContextReplacing<float>& context) noexcept;
+
+    /**
+        Filters interleaved frames in place. Only valid while canProcessFrames() is true.
+        @param frames    Frames to filter.
+        @param numFrames Number of frames.
+    */
+    void processFrames(FrameRegister* frames, size_t numFrames) noexcept;
+
+    /**
+        Checks whether the IIR path runs without a path change, so the frame chain can take the block.
+    */
+    bool canProcessFrames() const noexcept { return !linearPhaseActive && fade == Fade::none; }
+
+    /**
+        Returns the delay of one path. Valid once prepared.
+        @param forLinearPhase True for the linear-phase FIR, false for the IIR filter.
+        @return The latency in samples; 0 for the IIR filter.
+    */
+    int getLatencySamples(bool forLinearPhase) const noexcept { return forLinearPhase ? linearPhase.getLatencySamples() : 0; }
+
+    static constexpr double fadeSeconds = 0.01;    ///< Length of the fade out and back in of a path change
+
+private:
+    enum class Fade { none, out, ringOut, in };
+
+    /**
+        Applies the fade of a path change to the input of one block, sample by sample.
+        @return True if the old path has rung out and the new one can take over.
+    */
+    bool applyFade(juce::dsp::AudioBlock<float>& block, size_t numChannels) noexcept;
+
+    /// Starts the requested path from silence and fades the input back in.
+    void switchPath() noexcept;
+
+    LowCutFilter iir;
+    LinearPhaseHighPass linearPhase;
+
+    bool useLinearPhase = false;            ///< The requested path
+    bool linearPhaseActive = false;         ///< The path that currently runs
+    Fade fade = Fade::none;
+    float fadeGain = 1.0f;                  ///< Input gain during a path change
+    float fadeStep = 1.0f;                  ///< Change of fadeGain per sample
+    int ringOutRemaining = 0;               ///< Silent samples left before the old path is cut off
+    int iirRingOutSamples = 0;              ///< Tail of the IIR path, fed silence before a change
+    int firRingOutSamples = 0;              ///< Delay plus trailing half of the kernel
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LowCutStage)
+};
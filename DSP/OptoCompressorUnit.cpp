@@ -47,26 +47,48 @@ void OptoCompressorUnit::reset()
 }
 
 //==============================================================================
+template <size_t NumChannels>
 void OptoCompressorUnit::processCompression(juce::dsp::ProcessContextReplacing<float> context)
 {
     const juce::dsp::AudioBlock<float>& block = context.getOutputBlock();
 
     // Measure block RMS and convert to dB
-    float inputLevelDb = calculateRMS(block);
+    float inputLevelDb = calculateRMS<NumChannels>(block);
 
+    // Apply smoothed gain to audio
+    optoGain.setGainLinear(computeBlockGain(inputLevelDb));
+    optoGain.process(context);
+}
+
+template void OptoCompressorUnit::processCompression<0>(juce::dsp::ProcessContextReplacing<float>);
+template void OptoCompressorUnit::processCompression<1>(juce::dsp::ProcessContextReplacing<float>);
+template void OptoCompressorUnit::processCompression<2>(juce::dsp::ProcessContextReplacing<float>);
+
+void OptoCompressorUnit::processFrames(FrameRegister* frames, size_t numFrames, size_t numChannels) noexcept
+{
+    // Unused lanes are zero, so summing every lane equals summing the active channels
+    auto squares = FrameRegister::expand(0.0f);
+    for (size_t i = 0; i < numFrames; ++i)
+        squares += frames[i] * frames[i];
+
+    const float meanSquare = squares.sum() / float(numChannels * numFrames);
+    const float inputLevelDb = juce::Decibels::gainToDecibels(std::sqrt(meanSquare), -100.0f);
+
+    const auto gain = FrameRegister::expand(computeBlockGain(inputLevelDb));
+    for (size_t i = 0; i < numFrames; ++i)
+        frames[i] = frames[i] * gain;
+}
+
+float OptoCompressorUnit::computeBlockGain(float inputLevelDb)
+{
     // Envelope follower with separate attack/release smoothing
     if (inputLevelDb > envelopeDb)
         envelopeDb += (inputLevelDb - envelopeDb) * attackCoeff;
     else
         envelopeDb += (inputLevelDb - envelopeDb) * releaseCoeff;
 
-    // Compute overshoot above threshold
-    float overshootDb = envelopeDb - fixedThreshold;
-
-    // Apply ratio if overshoot exists
-    float gainReductionDb = (overshootDb > 0.0f)
-        ? overshootDb * (1.0f - 1.0f / fixedRatio)
-        : 0.0f;
+    // Apply the ratio to the overshoot above the threshold
+    float gainReductionDb = computeGainReductionDb(envelopeDb);
 
     // Convert gain reduction to linear (negative dB = attenuation)
     float linearGain = juce::Decibels::decibelsToGain(-gainReductionDb);
@@ -79,33 +101,28 @@ void OptoCompressorUnit::processCompression(juce::dsp::ProcessContextReplacing<f
     for (int i = 0; i < smoothingSteps; ++i)
         gainSum += smoothedGain.getNextValue();
 
-    const float averagedGain = gainSum / static_cast<float>(smoothingSteps);
-
-    // Apply smoothed gain to audio
-    optoGain.setGainLinear(averagedGain);
-    optoGain.process(context);
+    return gainSum / static_cast<float>(smoothingSteps);
 }
 
 //==============================================================================
-float OptoCompressorUnit::calculateRMS(juce::dsp::AudioBlock<float> block)
+template <size_t NumChannels>
+float OptoCompressorUnit::calculateRMS(const juce::dsp::AudioBlock<float>& block) const noexcept
 {
-    int numChannels = static_cast<int>(block.getNumChannels());
-    int numSamples = static_cast<int>(block.getNumSamples());
+    const size_t numChannels = NumChannels > 0 ? NumChannels : block.getNumChannels();
+    const size_t numSamples = block.getNumSamples();
 
     float sumOfSquares = 0.0f;
 
     // Accumulate square of all samples
-    for (int chan = 0; chan < numChannels; ++chan)
+    for (size_t chan = 0; chan < numChannels; ++chan)
     {
-        for (int samp = 0; samp < numSamples; ++samp)
-        {
-            float sample = block.getSample(chan, samp);
-            sumOfSquares += sample * sample;
-        }
+        const float* data = block.getChannelPointer(chan);
+        for (size_t samp = 0; samp < numSamples; ++samp)
+            sumOfSquares += data[samp] * data[samp];
     }
 
     // Calculate RMS from mean square
-    float meanSquare = sumOfSquares / (numChannels * numSamples);
+    float meanSquare = sumOfSquares / float(numChannels * numSamples);
     float rms = std::sqrt(meanSquare);
 
     // Convert to dBFS with a floor to avoid log(0)
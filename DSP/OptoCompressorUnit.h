@@ -11,6 +11,7 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "FrameProcessing.h"
 
 /**
     A simple opto-style compressor that mimics analog optical compression behavior
@@ -38,10 +39,36 @@ public:
         Processes a block of audio using opto-style compression.
         Applies envelope following, computes gain reduction, smooths gain,
         and applies the final gain to the audio block.
+        @tparam NumChannels Channel count of the block (1 or 2), or 0 to take it from the block.
         @param context A JUCE processing context containing the audio block.
     */
+    template <size_t NumChannels = 0>
     void processCompression(juce::dsp::ProcessContextReplacing<float> context);
 
+    /**
+        Processes interleaved frames with the same detector and gain as processCompression().
+        @param frames      Frames to process in place.
+        @param numFrames   Number of frames.
+        @param numChannels Number of lanes carrying a channel (unused lanes must be zero).
+    */
+    void processFrames(FrameRegister* frames, size_t numFrames, size_t numChannels) noexcept;
+
+    /**
+        Static curve of the gain computer.
+        @param levelDb Envelope level in dBFS.
+        @return The gain reduction in dB (positive).
+    */
+    static float computeGainReductionDb(float levelDb) noexcept
+    {
+        const float overshootDb = levelDb - fixedThreshold;
+        return overshootDb > 0.0f ? overshootDb * (1.0f - 1.0f / fixedRatio) : 0.0f;
+    }
+
+    static constexpr float fixedAttack = 15.0f;        ///< Fixed attack time in ms
+    static constexpr float fixedRelease = 120.0f;      ///< Fixed release time in ms
+    static constexpr float fixedRatio = 5.0f;          ///< Compression ratio
+    static constexpr float fixedThreshold = -18.0f;    ///< Compression threshold in dB
+
 private:
     juce::dsp::Gain<float> optoGain;                   ///< Gain processor for applying gain reduction
     juce::LinearSmoothedValue<float> smoothedGain;     ///< Smoother to prevent gain stepping artifacts
@@ -49,11 +76,6 @@ private:
     const double optoSmoothingTime = 0.1;              ///< Smoothing time for output gain, in seconds
     const int smoothingSteps = 4;                      ///< Number of times to sample smoothing per block
 
-    float fixedAttack = 15.0f;                         ///< Fixed attack time in ms
-    float fixedRelease = 120.0f;                       ///< Fixed release time in ms
-    float fixedRatio = 5.0f;                           ///< Compression ratio
-    float fixedThreshold = -18.0f;                     ///< Compression threshold in dB
-
     double sampleRate = 44100.0;                       ///< Current sample rate
     float envelopeDb = -100.0f;                        ///< Smoothed input level in dB
 
@@ -62,10 +84,19 @@ private:
 
     /**
         Computes the RMS level of a block and returns it in decibels.
+        @tparam NumChannels Channel count of the block, or 0 to take it from the block.
         @param block A block of audio samples.
         @return The RMS level in dBFS, floor-limited to -100 dB.
     */
-    float calculateRMS(juce::dsp::AudioBlock<float> block);
+    template <size_t NumChannels>
+    float calculateRMS(const juce::dsp::AudioBlock<float>& block) const noexcept;
+
+    /**
+        Runs the envelope follower and gain computer for one block.
+        @param inputLevelDb The block RMS level in dBFS.
+        @return The smoothed linear gain to apply to the block.
+    */
+    float computeBlockGain(float inputLevelDb);
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OptoCompressorUnit)
 };
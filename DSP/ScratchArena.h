@@ -0,0 +1,96 @@
+/*
+  ==============================================================================
+
+    ScratchArena.h
+    Created: 18 Oct 2026 4:06:31pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/**
+    One aligned block of memory from which the processing stages carve their scratch buffers.
+    The arena is sized and allocated in prepareToPlay; every carve after that is a pointer bump,
+    so nothing on the audio thread touches the heap. Carved buffers stay valid until the next prepare().
+
+    Sizing works in two passes: add up bytesFor() of every buffer a stage will carve, call prepare()
+    with the total, then let each stage carve in the same order.
+*/
+class ScratchArena
+{
+public:
+    /// Alignment of every carved buffer; covers AVX registers and a cache line.
+    static constexpr size_t alignment = 64;
+
+    /**
+        Returns the arena space a buffer of count elements occupies, including alignment padding.
+        @param count Number of elements of type T.
+    */
+    template <typename T>
+    static constexpr size_t bytesFor(size_t count) noexcept
+    {
+        return (sizeof(T) * count + alignment - 1) & ~(alignment - 1);
+    }
+
+    /**
+        Allocates and zeroes the arena and rewinds it. Not real-time safe.
+        Invalidates every buffer carved before.
+        @param capacityBytes Total size, usually a sum of bytesFor() results.
+    */
+    void prepare(size_t capacityBytes)
+    {
+        if (capacityBytes != capacity)
+        {
+            storage.allocate(capacityBytes + alignment, true);
+            capacity = capacityBytes;
+        }
+        else
+        {
+            storage.clear(capacity + alignment);
+        }
+
+        // HeapBlock only guarantees malloc alignment; round the start up ourselves
+        const auto address = reinterpret_cast<juce::pointer_sized_uint>(storage.get());
+        base = storage.get() + ((alignment - (address & (alignment - 1))) & (alignment - 1));
+        used = 0;
+    }
+
+    /**
+        Carves a buffer of count elements. The memory is zeroed by prepare() but not between carves.
+        @param count Number of elements of type T.
+        @return The buffer, or nullptr if the arena was sized too small.
+    */
+    template <typename T>
+    T* allocate(size_t count) noexcept
+    {
+        static_assert(alignof(T) <= alignment, "ScratchArena cannot satisfy this alignment");
+
+        const size_t numBytes = bytesFor<T>(count);
+        jassert(used + numBytes <= capacity);  // A stage carved more than it asked for when sizing
+
+        if (used + numBytes > capacity)
+            return nullptr;
+
+        auto* buffer = reinterpret_cast<T*>(base + used);
+        used += numBytes;
+        return buffer;
+    }
+
+    /// @returns Bytes carved since the last prepare().
+    size_t getBytesUsed() const noexcept { return used; }
+
+    /// @returns Usable size of the arena in bytes.
+    size_t getCapacity() const noexcept { return capacity; }
+
+private:
+    juce::HeapBlock<char> storage;      ///< Backing memory, alignment bytes larger than capacity
+    char* base = nullptr;               ///< First aligned byte of storage
+    size_t capacity = 0;
+    size_t used = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ScratchArena)
+};
@@ -0,0 +1,270 @@
+/*
+  ==============================================================================
+
+    TruePeakLimiter.cpp
+    Created: 18 Oct 2026 5:12:44pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "TruePeakLimiter.h"
+
+//==============================================================================
+void TruePeakLimiter::SlidingMaximum::prepare(int newWindowLength)
+{
+    windowLength = juce::jmax(1, newWindowLength);
+    capacity = windowLength + 1;
+    values.assign((size_t)capacity, 0.0f);
+    times.assign((size_t)capacity, 0);
+    reset();
+}
+
+void TruePeakLimiter::SlidingMaximum::reset() noexcept
+{
+    front = 0;
+    size = 0;
+    now = 0;
+}
+
+float TruePeakLimiter::SlidingMaximum::push(float value) noexcept
+{
+    // Drop the oldest candidate once it has left the window
+    if (size > 0 && now - times[(size_t)front] >= (juce::uint32)windowLength)
+    {
+        front = (front + 1) % capacity;
+        --size;
+    }
+
+    // Candidates smaller than the new value can never be the maximum again
+    while (size > 0)
+    {
+        const int back = (front + size - 1) % capacity;
+        if (values[(size_t)back] > value)
+            break;
+        --size;
+    }
+
+    const int slot = (front + size) % capacity;
+    values[(size_t)slot] = value;
+    times[(size_t)slot] = now;
+    ++size;
+    ++now;
+
+    return values[(size_t)front];
+}
+
+//==============================================================================
+void TruePeakLimiter::prepare(const juce::dsp::ProcessSpec& spec)
+{
+    lookahead = juce::jmax(1, juce::roundToInt(spec.sampleRate * lookaheadSeconds));
+    delayLength = getLatencySamples() + 1;
+
+    ceiling = juce::Decibels::decibelsToGain(ceilingDb);
+    releaseCoeff = (float)std::exp(-1.0 / (spec.sampleRate * releaseSeconds));
+    engagementStep = 1.0f / (float)juce::jmax(1, juce::roundToInt(spec.sampleRate * engageSeconds));
+
+    // Blackman-windowed sinc interpolator, cutoff at the input Nyquist frequency
+    constexpr int numTaps = oversampling * tapsPerPhase;
+    std::array<float, numTaps> window{};
+    juce::dsp::WindowingFunction<float>::fillWindowingTables(window.data(), window.size(),
+        juce::dsp::WindowingFunction<float>::blackman, false);
+
+    const double centre = (numTaps - 1) * 0.5;
+
+    for (int p = 0; p < oversampling; ++p)
+    {
+        double phaseSum = 0.0;
+
+        for (int k = 0; k < tapsPerPhase; ++k)
+        {
+            const double x = (k * oversampling + p - centre) / oversampling;
+            const double sinc = std::abs(x) < 1.0e-9
+                ? 1.0
+                : std::sin(juce::MathConstants<double>::pi * x) / (juce::MathConstants<double>::pi * x);
+
+            phases[(size_t)p][(size_t)k] = float(sinc * window[(size_t)(k * oversampling + p)]);
+            phaseSum += phases[(size_t)p][(size_t)k];
+        }
+
+        // Unity DC gain per branch so a constant input reads the same at every phase
+        for (auto& tap : phases[(size_t)p])
+            tap = float(tap / phaseSum);
+    }
+
+    channels.resize(spec.numChannels);
+    for (auto& state : channels)
+        state.delayLine.assign((size_t)delayLength, 0.0f);
+
+    peakWindow.prepare(lookahead);
+    boxBuffer.assign((size_t)lookahead, 1.0f);
+
+    reset();
+}
+
+void TruePeakLimiter::reset() noexcept
+{
+    for (auto& state : channels)
+    {
+        state.history.fill(0.0f);
+        std::fill(state.delayLine.begin(), state.delayLine.end(), 0.0f);
+    }
+
+    historyPosition = 0;
+    delayPosition = 0;
+
+    peakWindow.reset();
+    std::fill(boxBuffer.begin(), boxBuffer.end(), 1.0f);
+    boxSum = (double)lookahead;
+    boxPosition = 0;
+    envelope = 1.0f;
+
+    // Starts in the requested state without a fade
+    detecting = engaged;
+    engagement = engaged ? 1.0f : 0.0f;
+}
+
+void TruePeakLimiter::setEngaged(bool shouldBeEngaged) noexcept
+{
+    if (shouldBeEngaged == engaged)
+        return;
+
+    engaged = shouldBeEngaged;
+
+    if (engaged && !detecting)
+    {
+        restartDetector();
+        detecting = true;
+    }
+}
+
+void TruePeakLimiter::restartDetector() noexcept
+{
+    for (auto& state : channels)
+        state.history.fill(0.0f);
+
+    historyPosition = 0;
+
+    peakWindow.reset();
+    std::fill(boxBuffer.begin(), boxBuffer.end(), 1.0f);
+    boxSum = (double)lookahead;
+    boxPosition = 0;
+    envelope = 1.0f;
+
+    // The delayed samples have not left the limiter yet, so the gain for them is computed as usual
+    for (int k = 1; k < delayLength; ++k)
+    {
+        const int position = (delayPosition + k) % delayLength;
+
+        float peak = 0.0f;
+        for (auto& state : channels)
+            peak = juce::jmax(peak, detectTruePeak(state, state.delayLine[(size_t)position]));
+
+        historyPosition = (historyPosition + 1) % tapsPerPhase;
+        computeGain(peak);
+    }
+}
+
+//==============================================================================
+float TruePeakLimiter::detectTruePeak(ChannelState& state, float input) noexcept
+{
+    state.history[(size_t)historyPosition] = input;
+    state.history[(size_t)(historyPosition + tapsPerPhase)] = input;
+
+    // history[newest - k] for k = 0...tapsPerPhase-1, oldest last
+    const float* newest = state.history.data() + historyPosition + tapsPerPhase;
+
+    // The sample at the interpolator's centre lines up with the oversampled phases around it
+    float peak = std::abs(newest[-interpolatorDelay]);
+
+    for (const auto& phase : phases)
+    {
+        float y = 0.0f;
+        for (int k = 0; k < tapsPerPhase; ++k)
+            y += phase[(size_t)k] * newest[-k];
+
+        peak = juce::jmax(peak, std::abs(y));
+    }
+
+    return peak;
+}
+
+float TruePeakLimiter::computeGain(float peak) noexcept
+{
+    // Hold the peak over the lookahead window and turn it into the gain that meets the ceiling
+    const float heldPeak = peakWindow.push(peak);
+    const float target = heldPeak > ceiling ? ceiling / heldPeak : 1.0f;
+
+    // Instant attack, one-pole release
+    envelope = target < envelope ? target : target + releaseCoeff * (envelope - target);
+
+    // Box filter over the same window: reaches the held gain exactly when the peak leaves the delay
+    boxSum += envelope - boxBuffer[(size_t)boxPosition];
+    boxBuffer[(size_t)boxPosition] = envelope;
+    boxPosition = (boxPosition + 1) % lookahead;
+
+    return float(boxSum / lookahead);
+}
+
+void TruePeakLimiter::process(const juce::dsp::ProcessContextReplacing<float>& context) noexcept
+{
+    auto& block = context.getOutputBlock();
+    const size_t numChannels = juce::jmin(block.getNumChannels(), channels.size());
+    const size_t numSamples = block.getNumSamples();
+
+    if (!detecting)
+    {
+        processDelayOnly(block, numChannels);
+        return;
+    }
+
+    const float engagementTarget = engaged ? 1.0f : 0.0f;
+
+    for (size_t i = 0; i < numSamples; ++i)
+    {
+        const int readPosition = (delayPosition + 1) % delayLength;
+
+        // Linked true-peak detection; the sample itself goes into the delay line
+        float peak = 0.0f;
+        for (size_t ch = 0; ch < numChannels; ++ch)
+        {
+            float& sample = block.getChannelPointer(ch)[i];
+            peak = juce::jmax(peak, detectTruePeak(channels[ch], sample));
+            channels[ch].delayLine[(size_t)delayPosition] = sample;
+        }
+
+        historyPosition = (historyPosition + 1) % tapsPerPhase;
+        delayPosition = readPosition;
+
+        if (engagement != engagementTarget)
+            engagement = engaged ? juce::jmin(1.0f, engagement + engagementStep)
+                                 : juce::jmax(0.0f, engagement - engagementStep);
+
+        const float gain = 1.0f + (computeGain(peak) - 1.0f) * engagement;
+
+        for (size_t ch = 0; ch < numChannels; ++ch)
+            block.getChannelPointer(ch)[i] = channels[ch].delayLine[(size_t)readPosition] * gain;
+    }
+
+    if (!engaged && engagement == 0.0f)
+        detecting = false;
+}
+
+void TruePeakLimiter::processDelayOnly(juce::dsp::AudioBlock<float>& block, size_t numChannels) noexcept
+{
+    const size_t numSamples = block.getNumSamples();
+
+    for (size_t i = 0; i < numSamples; ++i)
+    {
+        const int readPosition = (delayPosition + 1) % delayLength;
+
+        for (size_t ch = 0; ch < numChannels; ++ch)
+        {
+            float& sample = block.getChannelPointer(ch)[i];
+            channels[ch].delayLine[(size_t)delayPosition] = sample;
+            sample = channels[ch].delayLine[(size_t)readPosition];
+        }
+
+        delayPosition = readPosition;
+    }
+}
@@ -0,0 +1,151 @@
+/*
+  ==============================================================================
+
+    TruePeakLimiter.h
+    Created: 18 Oct 2026 5:12:44pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <vector>
+
+/**
+    Lookahead brickwall limiter with a 4x oversampled true-peak detector.
+    The detector output is held over the lookahead window with an O(1) sliding maximum, turned into
+    a gain, released with a one-pole filter and smoothed with a box filter of the same length, so the
+    gain has fully settled by the time the delayed peak reaches the output. All channels share one gain.
+    Disengaging fades the gain to unity but keeps the delay line, so the latency never changes; while
+    disengaged only the delay runs.
+*/
+class TruePeakLimiter
+{
+public:
+    /// Constructs an unprepared limiter. Call prepare() before processing.
+    TruePeakLimiter() = default;
+
+    /**
+        Designs the interpolator and allocates the delay lines and detector windows.
+        @param spec The JUCE DSP process specification (sample rate, block size, channels).
+    */
+    void prepare(const juce::dsp::ProcessSpec& spec);
+
+    /**
+        Clears the delay lines and returns the gain to unity.
+    */
+    void reset() noexcept;
+
+    /**
+        Engages or disengages the limiter. The gain fades over engageSeconds; a detector that was
+        stopped first catches up on the samples still in the delay line.
+        @param shouldBeEngaged True to limit, false to only delay.
+    */
+    void setEngaged(bool shouldBeEngaged) noexcept;
+
+    /**
+        Limits the block in place.
+        @param context A JUCE processing context containing the audio block.
+    */
+    void process(const juce::dsp::ProcessContextReplacing<float>& context) noexcept;
+
+    /**
+        Returns the delay of the limiter: lookahead window plus the interpolator's group delay.
+        @return The latency in samples.
+    */
+    int getLatencySamples() const noexcept { return lookahead - 1 + interpolatorDelay; }
+
+    static constexpr float ceilingDb = -1.0f;               ///< True-peak ceiling in dBTP
+    static constexpr double lookaheadSeconds = 0.0015;      ///< Lookahead and gain smoothing window
+    static constexpr double releaseSeconds = 0.08;          ///< Release time constant
+    static constexpr double engageSeconds = 0.01;           ///< Fade in and out of the limiting gain
+    static constexpr int oversampling = 4;                  ///< True-peak interpolation factor
+    static constexpr int tapsPerPhase = 12;                 ///< Interpolator taps per polyphase branch
+    static constexpr int interpolatorDelay = tapsPerPhase / 2;   ///< Interpolator group delay in input samples
+
+private:
+    /**
+        Sliding-window maximum over a monotonic deque held in a fixed ring buffer.
+        Every value is pushed and popped at most once, so the cost per sample does not grow
+        with the window length.
+    */
+    class SlidingMaximum
+    {
+    public:
+        /// Allocates the ring for the given window. Not real-time safe.
+        void prepare(int newWindowLength);
+
+        /// Empties the window.
+        void reset() noexcept;
+
+        /**
+            Adds a value and drops the one that left the window.
+            @param value The newest value.
+            @return The maximum of the last windowLength values.
+        */
+        float push(float value) noexcept;
+
+    private:
+        std::vector<float> values;          ///< Candidates, decreasing from front to back
+        std::vector<juce::uint32> times;    ///< Push time of each candidate
+        int capacity = 1;
+        int front = 0;
+        int size = 0;
+        int windowLength = 1;
+        juce::uint32 now = 0;
+    };
+
+    /// Per-channel interpolator history and output delay line.
+    struct ChannelState
+    {
+        std::array<float, 2 * tapsPerPhase> history{};     ///< Doubled ring so every window is contiguous
+        std::vector<float> delayLine;
+    };
+
+    /**
+        Pushes one sample into a channel's interpolator and returns its largest oversampled magnitude.
+        @param state The channel state.
+        @param input The new input sample.
+    */
+    float detectTruePeak(ChannelState& state, float input) noexcept;
+
+    /**
+        Turns the detected peak of one sample into the smoothed limiting gain.
+        @param peak The linked true peak of the newest sample.
+        @return The gain for the sample leaving the delay line.
+    */
+    float computeGain(float peak) noexcept;
+
+    /// Clears the detector and runs it over the samples waiting in the delay line.
+    void restartDetector() noexcept;
+
+    /// Moves the samples through the delay line without limiting them.
+    void processDelayOnly(juce::dsp::AudioBlock<float>& block, size_t numChannels) noexcept;
+
+    std::array<std::array<float, tapsPerPhase>, oversampling> phases{};   ///< Polyphase interpolator
+
+    std::vector<ChannelState> channels;
+    int historyPosition = 0;                ///< Shared write position of all interpolator histories
+    int delayPosition = 0;                  ///< Shared write position of all delay lines
+    int delayLength = 1;
+
+    SlidingMaximum peakWindow;
+    std::vector<float> boxBuffer;           ///< Last lookahead gains for the box filter
+    double boxSum = 0.0;
+    int boxPosition = 0;
+
+    int lookahead = 1;                      ///< Window length in samples
+    float ceiling = 1.0f;                   ///< Linear ceiling
+    float releaseCoeff = 0.0f;
+    float envelope = 1.0f;                  ///< Released gain before the box filter
+
+    bool engaged = false;                   ///< Requested state
+    bool detecting = false;                 ///< Detector is running; false once fully disengaged
+    float engagement = 0.0f;                ///< 0 passes the delayed input, 1 applies the full gain
+    float engagementStep = 1.0f;            ///< Change of engagement per sample
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TruePeakLimiter)
+};
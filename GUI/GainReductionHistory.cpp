@@ -0,0 +1,247 @@
+/*
+  ==============================================================================
+
+    GainReductionHistory.cpp
+    Created: 18 Oct 2026 8:02:47pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "GainReductionHistory.h"
+#include "../LookAndFeel/Colors.h"
+#include "../LookAndFeel/Fonts.h"
+#include "../LookAndFeel/LAFCommon.h"
+
+GainReductionHistory::GainReductionHistory()
+{
+    setOpaque(true);
+}
+
+GainReductionHistory::~GainReductionHistory() = default;
+
+/**
+ * @brief Accumulates a block into the open column and closes every column it completes.
+ *
+ * A block longer than a column fills several columns with the same value, so
+ * the time axis stays exact for any block size.
+ */
+void GainReductionHistory::pushBlock(float gain, double blockSeconds) noexcept
+{
+    if (!history.isValid() || secondsPerColumn <= 0.0)
+        return;
+
+    const float db = juce::Decibels::gainToDecibels(gain, mindB);
+    columnDb = juce::jmin(columnDb, db);
+    columnSeconds += blockSeconds;
+
+    bool added = false;
+
+    while (columnSeconds >= secondsPerColumn)
+    {
+        renderColumn(columnDb);
+        columnSeconds -= secondsPerColumn;
+        columnDb = db;
+        added = true;
+    }
+
+    if (added)
+        repaint(plotArea);
+}
+
+void GainReductionHistory::setHistoryLength(double seconds)
+{
+    historySeconds = juce::jlimit(minSeconds, maxSeconds, seconds);
+    resized();
+    repaint();
+}
+
+/**
+ * @brief Draws the ring so that the newest column ends at the right edge.
+ *
+ * Columns [writeColumn, width) are the oldest and go first, [0, writeColumn)
+ * follow. Two image blits plus a few labels, whatever the history length.
+ */
+void GainReductionHistory::paint(juce::Graphics& g)
+{
+    g.fillAll(Colors::LevelMeter::background);
+
+    if (history.isValid())
+    {
+        // The image is in physical pixels; two copies side by side, clipped to the plot, show the ring in order
+        const float olderX = (float)plotArea.getX() - (float)writeColumn / historyScale;
+        const auto toLogical = juce::AffineTransform::scale(1.0f / historyScale);
+
+        juce::Graphics::ScopedSaveState state(g);
+        g.reduceClipRegion(plotArea);
+        g.drawImageTransformed(history, toLogical.translated(olderX, (float)plotArea.getY()));
+
+        if (writeColumn > 0)
+            g.drawImageTransformed(history, toLogical.translated(olderX + (float)history.getWidth() / historyScale,
+                (float)plotArea.getY()));
+    }
+
+    g.setColour(Colors::LevelMeter::border);
+    g.drawRoundedRectangle(getLocalBounds().toFloat().reduced(0.5f), 4.0f, 1.0f);
+
+    g.setFont(Fonts::getFont(11.0f));
+    g.setColour(Colors::LevelMeter::tickLabel);
+
+    for (float db = maxdB - stepdB; db >= mindB + 1.0e-3f; db -= stepdB)
+    {
+        const int y = plotArea.getY() + juce::roundToInt(juce::jmap(db, maxdB, mindB, 0.0f, (float)plotArea.getHeight()));
+        g.drawText(juce::String(int(db)), plotArea.getRight() - 24, y - 6, 22, 12, juce::Justification::centredRight);
+    }
+
+    g.drawText(juce::String(juce::roundToInt(historySeconds)) + " s", plotArea.reduced(4, 2),
+        juce::Justification::bottomLeft);
+}
+
+void GainReductionHistory::resized()
+{
+    plotArea = getLocalBounds().reduced(2);
+
+    if (plotArea.isEmpty())
+    {
+        history = {};
+        return;
+    }
+
+    historyScale = getPhysicalScale();
+    allocateHistory();
+}
+
+void GainReductionHistory::parentHierarchyChanged()
+{
+    updatePhysicalScale();
+}
+
+void GainReductionHistory::updatePhysicalScale()
+{
+    const float scale = getPhysicalScale();
+    if (scale == historyScale)
+        return;
+
+    if (history.isValid())
+    {
+        rescaleHistory(scale);
+        repaint();
+    }
+    else
+    {
+        historyScale = scale;
+    }
+}
+
+void GainReductionHistory::mouseDown(const juce::MouseEvent&)
+{
+    static constexpr double lengths[] = { 5.0, 10.0, 20.0, 30.0 };
+
+    for (auto length : lengths)
+    {
+        if (length > historySeconds + 1.0e-6)
+        {
+            setHistoryLength(length);
+            return;
+        }
+    }
+
+    setHistoryLength(lengths[0]);
+}
+
+float GainReductionHistory::getPhysicalScale() const
+{
+    // Transforms of the parents, e.g. the editor zoom, times the scale of the display the window is on
+    float scale = juce::Component::getApproximateScaleFactorForComponent(this);
+
+    if (auto* peer = getPeer())
+        scale *= (float)peer->getPlatformScaleFactor();
+
+    return quantiseLayerScale(scale);
+}
+
+void GainReductionHistory::allocateHistory()
+{
+    history = juce::Image(juce::Image::RGB,
+        juce::jmax(1, juce::roundToInt((float)plotArea.getWidth() * historyScale)),
+        juce::jmax(1, juce::roundToInt((float)plotArea.getHeight() * historyScale)), false);
+    secondsPerColumn = historySeconds / history.getWidth();
+
+    updateGridRows();
+    clearHistory();
+}
+
+/**
+ * @brief Moves the history to a new physical scale without losing it.
+ *
+ * The scale changes whenever the editor is resized, so the ring is unrolled
+ * oldest first and resampled instead of being cleared.
+ */
+void GainReductionHistory::rescaleHistory(float newScale)
+{
+    const int width = history.getWidth();
+
+    juce::Image ordered(juce::Image::RGB, width, history.getHeight(), false);
+    {
+        juce::Graphics g(ordered);
+        g.drawImageAt(history, -writeColumn, 0);
+        g.drawImageAt(history, width - writeColumn, 0);
+    }
+
+    historyScale = newScale;
+    history = ordered.rescaled(juce::jmax(1, juce::roundToInt((float)plotArea.getWidth() * historyScale)),
+        juce::jmax(1, juce::roundToInt((float)plotArea.getHeight() * historyScale)));
+
+    writeColumn = 0;
+    secondsPerColumn = historySeconds / history.getWidth();
+    updateGridRows();
+}
+
+void GainReductionHistory::updateGridRows()
+{
+    const int height = history.getHeight();
+
+    gridRows.assign((size_t)height, 0);
+    for (float db = maxdB - stepdB; db >= mindB + 1.0e-3f; db -= stepdB)
+    {
+        const int y = juce::roundToInt(juce::jmap(db, maxdB, mindB, 0.0f, (float)height));
+        if (juce::isPositiveAndBelow(y, height))
+            gridRows[(size_t)y] = 1;
+    }
+}
+
+/**
+ * @brief Writes a single column: reduction bar from the top, grid dots below it.
+ *
+ * Only the one-pixel column is locked, so the cost per column is O(height).
+ */
+void GainReductionHistory::renderColumn(float db)
+{
+    const int height = history.getHeight();
+    const int barEnd = juce::roundToInt(juce::jmap(juce::jlimit(mindB, maxdB, db), maxdB, mindB, 0.0f, (float)height));
+
+    const auto bar = Colors::LevelMeter::gainReduction;
+    const auto grid = Colors::LevelMeter::background.overlaidWith(Colors::LevelMeter::tickLine.withAlpha(0.25f));
+    const auto empty = Colors::LevelMeter::background;
+
+    {
+        juce::Image::BitmapData pixels(history, writeColumn, 0, 1, height, juce::Image::BitmapData::writeOnly);
+
+        for (int y = 0; y < height; ++y)
+            pixels.setPixelColour(0, y, y < barEnd ? bar : (gridRows[(size_t)y] != 0 ? grid : empty));
+    }
+
+    writeColumn = (writeColumn + 1) % history.getWidth();
+}
+
+void GainReductionHistory::clearHistory()
+{
+    writeColumn = 0;
+    columnSeconds = 0.0;
+    columnDb = maxdB;
+
+    for (int x = 0; x < history.getWidth(); ++x)
+        renderColumn(maxdB);
+
+    writeColumn = 0;
+}
@@ -0,0 +1,112 @@
+/*
+  ==============================================================================
+
+    GainReductionHistory.h
+    Created: 18 Oct 2026 8:02:47pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <vector>
+
+/**
+ * @class GainReductionHistory
+ * @brief Scrolling plot of the total gain reduction over the last few seconds.
+ *
+ * Incoming blocks are reduced to one value per pixel column (the deepest
+ * reduction inside the column). Each finished column is rendered once into a
+ * cached image used as a ring buffer; paint() only blits the two halves of the
+ * ring, so the cost per frame does not depend on the history length. The image
+ * has one column per physical pixel, so the plot stays sharp on HiDPI displays.
+ * Clicking the plot cycles through the available history lengths.
+ */
+class GainReductionHistory : public juce::Component
+{
+public:
+    /** Construct a new GainReductionHistory. */
+    GainReductionHistory();
+
+    /** Destructor. */
+    ~GainReductionHistory() override;
+
+    /**
+     * @brief Adds one processed block.
+     * @param gain         Linear gain of the block (1 = no reduction).
+     * @param blockSeconds Duration of the block in seconds.
+     */
+    void pushBlock(float gain, double blockSeconds) noexcept;
+
+    /**
+     * @brief Sets the time span shown across the width and clears the plot.
+     * @param seconds History length, limited to [minSeconds, maxSeconds].
+     */
+    void setHistoryLength(double seconds);
+
+    /** @return The time span shown across the width in seconds. */
+    double getHistoryLength() const noexcept { return historySeconds; }
+
+    /** Blits the cached history image and draws the frame and labels. */
+    void paint(juce::Graphics&) override;
+
+    /** Recreates the history image for the new size. */
+    void resized() override;
+
+    /** Picks up the scale of a new window or display. */
+    void parentHierarchyChanged() override;
+
+    /**
+     * @brief Resamples the history image if the physical scale changed, keeping what it shows.
+     *        Call after the owner changed the zoom of a parent, which the component cannot see.
+     */
+    void updatePhysicalScale();
+
+    /** Cycles through the history lengths. */
+    void mouseDown(const juce::MouseEvent&) override;
+
+    /// Top of the plot (no reduction).
+    static constexpr float maxdB = 0.0f;
+    /// Bottom of the plot.
+    static constexpr float mindB = -24.0f;
+    /// Spacing of the grid lines in dB.
+    static constexpr float stepdB = 6.0f;
+
+    static constexpr double minSeconds = 5.0;
+    static constexpr double maxSeconds = 30.0;
+
+private:
+    juce::Image history;            ///< Ring of rendered columns, one physical pixel wide each
+    juce::Rectangle<int> plotArea;  ///< Where the ring is blitted, in logical pixels
+    float historyScale = 1.0f;      ///< Physical pixels per logical pixel of the image
+    int writeColumn = 0;            ///< Next column of the ring to render
+
+    double historySeconds = 10.0;
+    double secondsPerColumn = 0.0;
+    double columnSeconds = 0.0;     ///< Time accumulated in the open column
+    float columnDb = maxdB;         ///< Deepest reduction in the open column
+
+    std::vector<juce::uint8> gridRows;   ///< 1 for rows that carry a grid line
+
+    /** @return The physical pixels per logical pixel of this component, quantised like the layer caches. */
+    float getPhysicalScale() const;
+
+    /** Allocates an empty image for plotArea at historyScale. */
+    void allocateHistory();
+
+    /** Resamples the image to a new scale, keeping what it shows. */
+    void rescaleHistory(float newScale);
+
+    /** Marks the rows of the image that carry a grid line. */
+    void updateGridRows();
+
+    /** Renders one finished column at writeColumn and advances the ring. */
+    void renderColumn(float db);
+
+    /** Fills the image with empty columns. */
+    void clearHistory();
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(GainReductionHistory)
+};
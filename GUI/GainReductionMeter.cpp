@@ -13,24 +13,29 @@
 /**
  * @brief Constructs a GainReductionMeter component.
  *
- * Stores references to the left and right RMS measurement objects,
- * attaches a custom LookAndFeel, sets the component to opaque, and
- * starts a timer for GUI updates.
- *
- * @param rmsL Reference to left channel RMS measurement.
- * @param rmsR Reference to right channel RMS measurement.
+ * Attaches a custom LookAndFeel and sets the component to opaque.
  */
-GainReductionMeter::GainReductionMeter(const RmsMeasurement& rmsL, const RmsMeasurement& rmsR)
-    : rmsMeasurementL(rmsL), rmsMeasurementR(rmsR)
+GainReductionMeter::GainReductionMeter()
 {
     setLookAndFeel(GainReductionMeterLookAndFeel::get());
     setOpaque(true);
-    startTimerHz(refreshRate);
-    lastUpdateMs = juce::Time::getMillisecondCounterHiRes();
 }
 
 GainReductionMeter::~GainReductionMeter() = default;
 
+/**
+ * @brief Accumulates the strongest gain reduction of the blocks since the last refresh.
+ *
+ * @param gainL Linear gain of the left channel.
+ * @param gainR Linear gain of the right channel.
+ */
+void GainReductionMeter::pushGainReduction(float gainL, float gainR) noexcept
+{
+    pendingGainL = hasPendingGain ? juce::jmin(pendingGainL, gainL) : gainL;
+    pendingGainR = hasPendingGain ? juce::jmin(pendingGainR, gainR) : gainR;
+    hasPendingGain = true;
+}
+
 /**
  * @brief Paints the meter using the assigned LookAndFeel.
  *
@@ -49,22 +54,16 @@ void GainReductionMeter::paint(juce::Graphics& g)
 /**
  * @brief Handles component resizing.
  *
- * Updates internal drawing bounds (minPos and maxPos) based on the
- * current width of the component.
+ * Updates the bar span (minPos and maxPos) used for dirty checks based
+ * on the current width of the component.
  */
 void GainReductionMeter::resized()
 {
     const float width = float(getWidth());
-    if (width < 10.f)
-    {
-        minPos = 4.f;
-        maxPos = 10.f;
-    }
-    else
-    {
-        minPos = 4.f;
-        maxPos = width - 4.f;
-    }
+
+    minPos = barInset;
+    maxPos = juce::jmax(minPos, width - barInset);
+    shownPosition = -1;
 }
 
 /**
@@ -103,32 +102,36 @@ float GainReductionMeter::getMaxRmsLevel() const
 }
 
 /**
- * @brief Timer callback executed at the refresh rate.
+ * @brief Called by the owner once per frame.
  *
- * - Measures elapsed time since the last update (dt).
- * - Clamps dt into [0, 0.25] seconds to avoid extreme jumps.
- * - Reads linear RMS values from both channels.
+ * - Takes the lowest linear gains pushed since the last frame, or keeps the
+ *   previous ones if no block arrived in between.
  * - Converts them to dB with a floor at mindB.
  * - Calls updateLevel() for each channel using dt-aware smoothing.
- * - Triggers repaint() to update the GUI.
+ * - Repaints only if the bar would end on a different pixel.
+ *
+ * @param elapsedSeconds Time since the previous refresh.
  */
-void GainReductionMeter::timerCallback()
+void GainReductionMeter::refresh(double elapsedSeconds)
 {
-    const double nowMs = juce::Time::getMillisecondCounterHiRes();
-    double dtSec = (nowMs - lastUpdateMs) / 1000.0;
-    lastUpdateMs = nowMs;
-
-    dtSec = juce::jlimit(0.0, 0.25, dtSec);
+    if (hasPendingGain)
+    {
+        shownGainL = pendingGainL;
+        shownGainR = pendingGainR;
+        hasPendingGain = false;
+    }
 
-    const float linearL = rmsMeasurementL.getValue();
-    const float linearR = rmsMeasurementR.getValue();
+    const float dbL = juce::Decibels::gainToDecibels(shownGainL, mindB);
+    const float dbR = juce::Decibels::gainToDecibels(shownGainR, mindB);
 
-    const float dbL = juce::Decibels::gainToDecibels(linearL, mindB);
-    const float dbR = juce::Decibels::gainToDecibels(linearR, mindB);
+    updateLevel(dbL, rmsLevelL, dbRmsLevelL, (float)elapsedSeconds);
+    updateLevel(dbR, rmsLevelR, dbRmsLevelR, (float)elapsedSeconds);
 
-    updateLevel(dbL, rmsLevelL, dbRmsLevelL, (float)dtSec);
-    updateLevel(dbR, rmsLevelR, dbRmsLevelR, (float)dtSec);
+    const int position = positionForLevel(getMaxRmsLevel(), minPos, maxPos);
+    if (position == shownPosition)
+        return;
 
+    shownPosition = position;
     repaint();
 }
 
@@ -10,31 +10,39 @@
 
 #pragma once
 #include <JuceHeader.h>
-#include "../Service/RMSMeasurement.h"
 
 /**
  * @class GainReductionMeter
  * @brief A GUI component that displays gain reduction levels with
  *        adjustable attack and release ballistics.
  *
- * Reads left/right RMS measurements from the audio thread, smooths them
- * using dt-aware attack/release filters, and repaints at a fixed GUI
- * refresh rate.
+ * Takes left/right gain reduction pushed by its owner, smooths it
+ * using dt-aware attack/release filters on every refresh() from the
+ * owner's frame scheduler, and repaints only when the bar moves.
  */
-class GainReductionMeter : public juce::Component,
-    private juce::Timer
+class GainReductionMeter : public juce::Component
 {
 public:
-    /**
-     * @brief Construct a new GainReductionMeter.
-     * @param rmsL Reference to the left channel RMS measurement.
-     * @param rmsR Reference to the right channel RMS measurement.
-     */
-    GainReductionMeter(const RmsMeasurement& rmsL, const RmsMeasurement& rmsR);
+    /** Construct a new GainReductionMeter. */
+    GainReductionMeter();
 
     /** Destructor. */
     ~GainReductionMeter() override;
 
+    /**
+     * @brief Feeds the gain reduction of one block. The strongest reduction fed since the
+     *        last refresh() is shown, so peaks between frames are not lost.
+     * @param gainL Linear gain of the left channel (1 = no reduction).
+     * @param gainR Linear gain of the right channel.
+     */
+    void pushGainReduction(float gainL, float gainR) noexcept;
+
+    /**
+     * @brief Advances the ballistics by one frame and repaints if the bar moved by a pixel or more.
+     * @param elapsedSeconds Time since the previous refresh.
+     */
+    void refresh(double elapsedSeconds);
+
     /** Paints the meter using the assigned LookAndFeel. */
     void paint(juce::Graphics&) override;
 
@@ -64,28 +72,28 @@ public:
     static constexpr float stepdB = 3.0f;
 
 private:
-    const RmsMeasurement& rmsMeasurementL;  ///< Left channel RMS source
-    const RmsMeasurement& rmsMeasurementR;  ///< Right channel RMS source
+    float pendingGainL = 1.0f;  ///< Lowest linear gain pushed since the last refresh (left)
+    float pendingGainR = 1.0f;  ///< Lowest linear gain pushed since the last refresh (right)
+    bool hasPendingGain = false;
+    float shownGainL = 1.0f;    ///< Gain the ballistics follow; held while no block arrives
+    float shownGainR = 1.0f;
 
     static constexpr float clampdB = mindB;
     static constexpr float clampLevel = 0.000001f;
-    static constexpr int refreshRate = 60; ///< GUI update frequency (Hz)
+    static constexpr float barInset = 17.0f;  ///< Border inset plus padding around the bar
 
     float maxPos = 0.0f;
     float minPos = 0.0f;
+    int shownPosition = -1;   ///< Bar end at the last repaint
 
     float rmsLevelL = mindB;
     float rmsLevelR = mindB;
     float dbRmsLevelL = 0.0f;
     float dbRmsLevelR = 0.0f;
 
-    double lastUpdateMs = 0.0;   ///< Last GUI update timestamp (ms)
     double attackT = 0.02;       ///< Attack time constant (s)
     double releaseT = 0.80;      ///< Release time constant (s)
 
-    /** Periodic GUI update. Reads RMS values, smooths, and repaints. */
-    void timerCallback() override;
-
     /**
      * @brief Smooth an input dB value toward a target with attack/release ballistics.
      * @param newLevel Input level in dB.
@@ -13,18 +13,13 @@
 
 //==============================================================================
 /**
-    Constructs a LevelMeter with given measurement references.
+    Constructs a LevelMeter.
 */
-LevelMeter::LevelMeter(Measurement& measurementL_, Measurement& measurementR_,
-    const RmsMeasurement& rmsMeasurementL_, const RmsMeasurement& rmsMeasurementR_)
-    : measurementL(measurementL_), measurementR(measurementR_),
-    rmsMeasurementL(rmsMeasurementL_), rmsMeasurementR(rmsMeasurementR_)
+LevelMeter::LevelMeter()
 {
     setLookAndFeel(LevelMeterLookAndFeel::get());
 
     setOpaque(true);
-    startTimerHz(refreshRate);
-    lastUpdateMs = juce::Time::getMillisecondCounterHiRes();
 }
 
 /**
@@ -32,6 +27,18 @@ LevelMeter::LevelMeter(Measurement& measurementL_, Measurement& measurementR_,
 */
 LevelMeter::~LevelMeter() = default;
 
+//==============================================================================
+/**
+    Accumulates one block's levels until the next refresh.
+*/
+void LevelMeter::pushLevels(float peakL, float peakR, float rmsL, float rmsR) noexcept
+{
+    pendingPeakL = juce::jmax(pendingPeakL, peakL);
+    pendingPeakR = juce::jmax(pendingPeakR, peakR);
+    latestRmsL = rmsL;
+    latestRmsR = rmsR;
+}
+
 //==============================================================================
 /**
     Paints the LevelMeter using its LookAndFeel.
@@ -48,48 +55,45 @@ void LevelMeter::paint(juce::Graphics& g)
 }
 
 /**
-    Handles resize events and recalculates meter bounds.
+    Handles resize events and recalculates the bar span used for dirty checks.
 */
 void LevelMeter::resized()
 {
     const float width = float(getWidth());
 
-    if (width < 10.f)
-    {
-        minPos = 4.f;
-        maxPos = 10.f;
-    }
-    else
-    {
-        minPos = 4.f;
-        maxPos = width - 4.f;
-    }
+    minPos = barInset;
+    maxPos = juce::jmax(minPos, width - barInset);
+    shownPositions.fill(-1);
 }
 
 //==============================================================================
 /**
-    Timer callback, called at `refreshRate`.
+    Called by the owner once per frame.
 
-    - Computes elapsed time (`dtSec`) since the last update.
-    - Updates smoothed peak levels for left/right channels.
-    - Updates RMS levels from `RmsMeasurement`.
-    - Repaints the component.
+    - Updates smoothed peak levels for left/right channels over `elapsedSeconds`.
+    - Updates RMS levels from the latest pushed values.
+    - Repaints only if one of the four bars would end on a different pixel.
 */
-void LevelMeter::timerCallback()
+void LevelMeter::refresh(double elapsedSeconds)
 {
-    const double nowMs = juce::Time::getMillisecondCounterHiRes();
-    double dtSec = (nowMs - lastUpdateMs) / 1000.0;
-    lastUpdateMs = nowMs;
+    updateLevel(pendingPeakL, levelL, dbLevelL, (float)elapsedSeconds);
+    updateLevel(pendingPeakR, levelR, dbLevelR, (float)elapsedSeconds);
+    pendingPeakL = 0.f;
+    pendingPeakR = 0.f;
 
-    // Clamp dt to avoid jumps from long UI stalls
-    dtSec = juce::jlimit(0.0, 0.25, dtSec);
+    dbRmsLevelL = juce::Decibels::gainToDecibels(latestRmsL, mindB);
+    dbRmsLevelR = juce::Decibels::gainToDecibels(latestRmsR, mindB);
 
-    updateLevel(measurementL.readAndReset(), levelL, dbLevelL, (float)dtSec);
-    updateLevel(measurementR.readAndReset(), levelR, dbLevelR, (float)dtSec);
+    const std::array<int, 4> positions{
+        positionForLevel(dbLevelL, minPos, maxPos),
+        positionForLevel(dbLevelR, minPos, maxPos),
+        positionForLevel(dbRmsLevelL, minPos, maxPos),
+        positionForLevel(dbRmsLevelR, minPos, maxPos) };
 
-    dbRmsLevelL = juce::Decibels::gainToDecibels(rmsMeasurementL.getValue(), mindB);
-    dbRmsLevelR = juce::Decibels::gainToDecibels(rmsMeasurementR.getValue(), mindB);
+    if (positions == shownPositions)
+        return;
 
+    shownPositions = positions;
     repaint();
 }
 
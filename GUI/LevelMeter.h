@@ -11,8 +11,7 @@
 #pragma once
 
 #include <JuceHeader.h>
-#include "../Service/Measurement.h"
-#include "../Service/RMSMeasurement.h"
+#include <array>
 
 //==============================================================================
 /**
@@ -20,23 +19,14 @@
 
     This class provides real-time level metering for audio signals, showing both
     peak and RMS values. Peak levels are smoothed using attack/release ballistics
-    for responsive but stable movement, while RMS values are fed directly from
-    an external `RmsMeasurement`.
+    for responsive but stable movement. Levels are pushed in by the owner, typically
+    once per drained telemetry record, and the owner's frame scheduler calls refresh().
 */
-class LevelMeter : public juce::Component,
-    private juce::Timer
+class LevelMeter : public juce::Component
 {
 public:
-    /**
-        Constructs a LevelMeter component.
-
-        @param measurementL      Peak measurement buffer for the left channel
-        @param measurementR      Peak measurement buffer for the right channel
-        @param rmsMeasurementL   RMS measurement reference for the left channel
-        @param rmsMeasurementR   RMS measurement reference for the right channel
-    */
-    LevelMeter(Measurement& measurementL, Measurement& measurementR,
-        const RmsMeasurement& rmsMeasurementL, const RmsMeasurement& rmsMeasurementR);
+    /// Constructs a LevelMeter component.
+    LevelMeter();
 
     /// Destructor.
     ~LevelMeter() override;
@@ -50,6 +40,23 @@ public:
     /// Step size between tick marks in dB.
     static constexpr float stepdB = 6.0f;
 
+    /**
+        Feeds one block's levels. Peaks are held until the next refresh, the RMS is replaced.
+
+        @param peakL  Linear peak (left)
+        @param peakR  Linear peak (right)
+        @param rmsL   Linear RMS (left)
+        @param rmsR   Linear RMS (right)
+    */
+    void pushLevels(float peakL, float peakR, float rmsL, float rmsR) noexcept;
+
+    /**
+        Advances the ballistics by one frame and repaints if any bar moved by a pixel or more.
+
+        @param elapsedSeconds  Time since the previous refresh
+    */
+    void refresh(double elapsedSeconds);
+
     /// Paints the level meter using its LookAndFeel.
     void paint(juce::Graphics&) override;
 
@@ -82,14 +89,14 @@ public:
 
 private:
     //==============================================================================
-    Measurement& measurementL;       ///< Peak measurement buffer (left)
-    Measurement& measurementR;       ///< Peak measurement buffer (right)
-    const RmsMeasurement& rmsMeasurementL; ///< RMS measurement reference (left)
-    const RmsMeasurement& rmsMeasurementR; ///< RMS measurement reference (right)
+    float pendingPeakL = 0.f;        ///< Largest pushed peak since the last refresh (left)
+    float pendingPeakR = 0.f;        ///< Largest pushed peak since the last refresh (right)
+    float latestRmsL = 0.f;          ///< Most recently pushed RMS (left)
+    float latestRmsR = 0.f;          ///< Most recently pushed RMS (right)
 
     static constexpr float clampdB = -120.f;     ///< Lower clamp in dB
     static constexpr float clampLevel = 0.000001f;  ///< Linear floor for gain values
-    static constexpr int  refreshRate = 60;         ///< Refresh rate in Hz
+    static constexpr float barInset = 17.0f;        ///< Border inset plus padding around the bars
 
     float dbLevelL = clampdB;   ///< Smoothed peak level (dB, left)
     float dbLevelR = clampdB;   ///< Smoothed peak level (dB, right)
@@ -100,17 +107,15 @@ private:
     float rmsLevelL = clampLevel;///< RMS level (linear, left)
     float rmsLevelR = clampLevel;///< RMS level (linear, right)
 
-    float maxPos = 0.f; ///< Rightmost meter pixel
-    float minPos = 0.f; ///< Leftmost meter pixel
+    float maxPos = 0.f; ///< Rightmost bar pixel
+    float minPos = 0.f; ///< Leftmost bar pixel
+
+    std::array<int, 4> shownPositions{ -1, -1, -1, -1 };  ///< Bar ends at the last repaint
 
-    double lastUpdateMs = 0.0;  ///< Last GUI update timestamp (ms)
     double attackT = 0.02; ///< Attack time constant (s)
     double releaseT = 0.80; ///< Release time constant (s)
 
     //==============================================================================
-    /// Called at the refresh rate to update meter values.
-    void timerCallback() override;
-
     /**
         Updates and smooths a single channel's peak level.
 
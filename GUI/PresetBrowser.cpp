@@ -0,0 +1,146 @@
+/*
+  ==============================================================================
+
+    PresetBrowser.cpp
+    Created: 19 Oct 2026 3:58:14am
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "PresetBrowser.h"
+#include "../LookAndFeel/Colors.h"
+#include "../LookAndFeel/Fonts.h"
+
+namespace Gui
+{
+    PresetBrowser::PresetBrowser(Service::PresetManager& pm)
+        : presetManager(pm)
+    {
+        searchBox.setTextToShowWhenEmpty("Search names and tags", Colors::PresetPanel::text.withAlpha(0.5f));
+        searchBox.setFont(Fonts::getFont(14.0f));
+        searchBox.setColour(juce::TextEditor::backgroundColourId, Colors::PresetPanel::boxBackground);
+        searchBox.setColour(juce::TextEditor::textColourId, Colors::PresetPanel::text);
+        searchBox.setColour(juce::TextEditor::outlineColourId, Colors::PresetPanel::outline);
+        searchBox.onTextChange = [this] { updateResults(); };
+        searchBox.onReturnKey = [this]
+        {
+            const int selected = resultList.getSelectedRow();
+            loadRow(selected >= 0 ? selected : 0);
+        };
+        addAndMakeVisible(searchBox);
+
+        resultList.setRowHeight(rowHeight);
+        resultList.setColour(juce::ListBox::backgroundColourId, Colors::PresetPanel::background);
+        resultList.setColour(juce::ListBox::outlineColourId, Colors::PresetPanel::outline);
+        resultList.setOutlineThickness(1);
+        addAndMakeVisible(resultList);
+
+        refresh();
+        setSize(browserWidth, browserHeight);
+    }
+
+    PresetBrowser::~PresetBrowser() = default;
+
+    //==============================================================================
+    void PresetBrowser::paint(juce::Graphics& g)
+    {
+        g.fillAll(Colors::PresetPanel::background);
+    }
+
+    void PresetBrowser::resized()
+    {
+        const int reduce = 4;
+        auto area = getLocalBounds().reduced(reduce);
+
+        searchBox.setBounds(area.removeFromTop(28));
+        area.removeFromTop(reduce);
+        resultList.setBounds(area);
+    }
+
+    void PresetBrowser::refresh()
+    {
+        const int version = presetManager.getPresetListVersion();
+        if (version == shownListVersion)
+            return;
+
+        shownListVersion = version;
+        snapshot = presetManager.getPresetSnapshot();
+        updateResults();
+    }
+
+    //==============================================================================
+    int PresetBrowser::getNumRows()
+    {
+        return (int)presetSearch.getResults().size();
+    }
+
+    /**
+     * @brief Draws one result: the name on the left and its tags, dimmed, on the right.
+     *
+     * Only called for rows in view.
+     */
+    void PresetBrowser::paintListBoxItem(int rowNumber, juce::Graphics& g, int width, int height, bool rowIsSelected)
+    {
+        const auto& results = presetSearch.getResults();
+        if (!juce::isPositiveAndBelow(rowNumber, (int)results.size()))
+            return;
+
+        const int preset = results[(size_t)rowNumber];
+        const auto& name = snapshot->names.getReference(preset);
+        const auto& tags = snapshot->tags[(size_t)preset];
+
+        if (rowIsSelected)
+            g.fillAll(Colors::PresetPanel::buttonBase);
+        else if (name == presetManager.getSelectedPreset())
+            g.fillAll(Colors::PresetPanel::boxBackground);
+
+        auto area = juce::Rectangle<int>(width, height).reduced(6, 0);
+
+        g.setFont(Fonts::getFont(12.0f));
+        g.setColour(Colors::PresetPanel::text.withAlpha(0.5f));
+        const auto tagText = tags.joinIntoString(", ");
+        const int tagWidth = juce::jmin(area.getWidth() / 2, juce::GlyphArrangement::getStringWidthInt(g.getCurrentFont(), tagText) + 6);
+        g.drawText(tagText, area.removeFromRight(tagWidth), juce::Justification::centredRight, true);
+
+        g.setFont(Fonts::getFont(14.0f));
+        g.setColour(Colors::PresetPanel::text);
+        g.drawText(name, area, juce::Justification::centredLeft, true);
+    }
+
+    void PresetBrowser::listBoxItemClicked(int row, [[maybe_unused]] const juce::MouseEvent& event)
+    {
+        loadRow(row);
+    }
+
+    void PresetBrowser::returnKeyPressed(int lastRowSelected)
+    {
+        loadRow(lastRowSelected);
+    }
+
+    //==============================================================================
+    void PresetBrowser::updateResults()
+    {
+        if (snapshot == nullptr)
+            return;
+
+        presetSearch.search(snapshot, searchBox.getText());
+
+        resultList.updateContent();
+        resultList.scrollToEnsureRowIsOnscreen(0);
+        resultList.selectRow(0, true, true);
+        resultList.repaint();
+    }
+
+    void PresetBrowser::loadRow(int row)
+    {
+        const auto& results = presetSearch.getResults();
+        if (!juce::isPositiveAndBelow(row, (int)results.size()))
+            return;
+
+        presetManager.loadPreset(snapshot->names[results[(size_t)row]]);
+
+        if (auto* callOut = findParentComponentOfClass<juce::CallOutBox>())
+            callOut->dismiss();
+    }
+} // namespace Gui
@@ -0,0 +1,71 @@
+/*
+  ==============================================================================
+
+    PresetBrowser.h
+    Created: 19 Oct 2026 3:58:14am
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "../Service/PresetManager.h"
+#include "../Service/PresetSearch.h"
+
+namespace Gui
+{
+    /**
+     * @class PresetBrowser
+     * @brief Search field and preset list shown in a call-out from the PresetPanel.
+     *
+     * Every keystroke runs a PresetSearch over the shared preset index; the ListBox only
+     * paints the rows in view, so filtering and scrolling cost the same for any library size.
+     * Clicking a row or pressing return loads the preset and closes the call-out.
+     */
+    class PresetBrowser : public juce::Component,
+        private juce::ListBoxModel
+    {
+    public:
+        /**
+         * @brief Construct a new PresetBrowser.
+         * @param pm The preset manager to search and load from; must outlive the browser.
+         */
+        explicit PresetBrowser(Service::PresetManager& pm);
+        ~PresetBrowser() override;
+
+        void paint(juce::Graphics& g) override;
+        void resized() override;
+
+        /** Searches again if the preset index changed since the results were built. */
+        void refresh();
+
+        static constexpr int browserWidth = 320;
+        static constexpr int browserHeight = 380;
+        static constexpr int rowHeight = 24;
+
+    private:
+        // ListBoxModel overrides
+        int getNumRows() override;
+        void paintListBoxItem(int rowNumber, juce::Graphics& g, int width, int height, bool rowIsSelected) override;
+        void listBoxItemClicked(int row, const juce::MouseEvent& event) override;
+        void returnKeyPressed(int lastRowSelected) override;
+
+        /** Runs the search for the text in the search field and shows the results. */
+        void updateResults();
+
+        /** Loads the preset shown in a row and closes the call-out. */
+        void loadRow(int row);
+
+        Service::PresetManager& presetManager;
+        Service::PresetSearch presetSearch;
+        std::shared_ptr<const Service::PresetIndex::Snapshot> snapshot;
+        int shownListVersion = -1;
+
+        juce::TextEditor searchBox;
+        juce::ListBox resultList{ "Presets", this };
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PresetBrowser)
+    };
+}
@@ -9,6 +9,7 @@
 */
 #include "PresetPanel.h"
 #include "../LookAndFeel/PresetPanelLAF.h"
+#include "../LookAndFeel/Colors.h"
 
 namespace Gui
 {
@@ -42,11 +43,9 @@ namespace Gui
         addAndMakeVisible(previousPresetButton);
         addAndMakeVisible(nextPresetButton);
 
-        // add the Preset list
-        presetList.setTextWhenNothingSelected("Select Preset");
-        presetList.setMouseCursor(juce::MouseCursor::PointingHandCursor);
-        addAndMakeVisible(presetList);
-        presetList.addListener(this);
+        // The preset name opens the searchable browser
+        configureButton(presetButton, "Select Preset");
+        presetButton.setColour(juce::TextButton::buttonColourId, Colors::PresetPanel::boxBackground);
 
         loadPresetList();
         setLookAndFeel(PresetPanelLookAndFeel::get());
@@ -58,7 +57,7 @@ namespace Gui
         actionButton->removeListener(this);
         previousPresetButton.removeListener(this);
         nextPresetButton.removeListener(this);
-        presetList.removeListener(this);
+        presetButton.removeListener(this);
     }
 
     //==============================================================================
@@ -76,20 +75,38 @@ namespace Gui
 
         previousPresetButton.setBounds(prevBounds);
         nextPresetButton.setBounds(nextBounds);
-        presetList.setBounds(comboBounds);
+        presetButton.setBounds(comboBounds);
         actionButton->setBounds(actionBounds);
     }
 
 
     void PresetPanel::loadPresetList()
     {
-        presetList.clear(juce::dontSendNotification);
+        updatePresetButton();
 
-        const auto allPresets = presetManager.getAllPresets();
-        const auto currentPreset = presetManager.getCurrentPreset();
+        if (presetBrowser != nullptr)
+            presetBrowser->refresh();
 
-        presetList.addItemList(allPresets, 1);
-        presetList.setSelectedItemIndex(allPresets.indexOf(currentPreset), false);
+        // The list may have changed around the current preset, so the next step is decoded ahead
+        presetManager.prefetchNeighbours();
+    }
+
+    void PresetPanel::refresh()
+    {
+        updatePresetButton();
+
+        // The browser builds its results when it opens and only rebuilds them while it is open
+        if (presetBrowser != nullptr)
+            presetBrowser->refresh();
+    }
+
+    void PresetPanel::updatePresetButton()
+    {
+        const auto selectedPreset = presetManager.getSelectedPreset();
+        const auto text = selectedPreset.isNotEmpty() ? selectedPreset : juce::String("Select Preset");
+
+        if (presetButton.getButtonText() != text)
+            presetButton.setButtonText(text);
     }
 
     //==============================================================================
@@ -103,6 +120,7 @@ namespace Gui
             menu.addItem(1, "Save New");
             menu.addItem(2, "Overwrite Current");
             menu.addItem(3, "Delete");
+            menu.addItem(4, "Edit Tags...");
 
             juce::Component::SafePointer<Gui::PresetPanel> safeThis = juce::Component::SafePointer<PresetPanel>(this);
 
@@ -115,22 +133,61 @@ namespace Gui
         }
         else if (button == &previousPresetButton)
         {
-            const int index = presetManager.loadPreviousPreset();
-            presetList.setSelectedItemIndex(index, false);
+            presetManager.loadPreviousPreset();
+            updatePresetButton();
         }
         else if (button == &nextPresetButton)
         {
-            const int index = presetManager.loadNextPreset();
-            presetList.setSelectedItemIndex(index, false);
+            presetManager.loadNextPreset();
+            updatePresetButton();
+        }
+        else if (button == &presetButton)
+        {
+            showPresetBrowser();
         }
     }
 
-    void PresetPanel::comboBoxChanged(juce::ComboBox* comboBoxThatHasChanged)
+    //==============================================================================
+    // Preset Browser
+
+    void PresetPanel::showPresetBrowser()
     {
-        if (comboBoxThatHasChanged == &presetList)
-        {
-            presetManager.loadPreset(presetList.getItemText(presetList.getSelectedItemIndex()));
-        }
+        auto browser = std::make_unique<PresetBrowser>(presetManager);
+        presetBrowser = browser.get();
+
+        // Inside the editor the call-out scales with it and stays in the plugin window, which
+        // hosts that run the editor in a child window need
+        auto* parent = getTopLevelComponent();
+        juce::CallOutBox::launchAsynchronously(std::move(browser),
+            parent->getLocalArea(&presetButton, presetButton.getLocalBounds()), parent);
+    }
+
+    void PresetPanel::showTagEditor()
+    {
+        const auto presetName = presetManager.getCurrentPreset();
+        if (presetName.isEmpty())
+            return;
+
+        const auto snapshot = presetManager.getPresetSnapshot();
+        const int index = snapshot->indexOf(presetName);
+        const auto currentTags = index >= 0 ? snapshot->tags[(size_t)index] : juce::StringArray();
+
+        auto* window = new juce::AlertWindow("Edit Tags", "Comma-separated tags for " + presetName,
+            juce::MessageBoxIconType::NoIcon, this);
+        window->addTextEditor("tags", currentTags.joinIntoString(", "));
+        window->addButton("Save", 1, juce::KeyPress(juce::KeyPress::returnKey));
+        window->addButton("Cancel", 0, juce::KeyPress(juce::KeyPress::escapeKey));
+
+        auto safeThis = juce::Component::SafePointer<PresetPanel>(this);
+
+        // The window deletes itself after the callback has run
+        window->enterModalState(true, juce::ModalCallbackFunction::create(
+            [safeThis, window, presetName](int result)
+            {
+                if (result == 1 && safeThis != nullptr)
+                    safeThis->presetManager.setPresetTags(presetName,
+                        juce::StringArray::fromTokens(window->getTextEditorContents("tags"), ",", ""));
+            }), true);
     }
 
     //==============================================================================
@@ -169,6 +226,11 @@ namespace Gui
             loadPresetList();
             break;
         }
+        case 4: // Edit Tags
+        {
+            showTagEditor();
+            break;
+        }
         default:
             break;
         }
@@ -12,12 +12,12 @@
 
 #include <JuceHeader.h>
 #include "../Service/PresetManager.h"
+#include "PresetBrowser.h"
 
 namespace Gui
 {
     class PresetPanel : public juce::Component,
-        private juce::Button::Listener,
-        private juce::ComboBox::Listener
+        private juce::Button::Listener
     {
     public:
         PresetPanel(Service::PresetManager& pm);
@@ -26,10 +26,20 @@ namespace Gui
         void resized() override;
         void loadPresetList();
 
+        /**
+            Called every frame: shows the preset once it has loaded, and lets an open browser
+            pick up a changed preset index. Nothing is rebuilt while the browser is closed.
+        */
+        void refresh();
+
     private:
         // Listener overrides
         void buttonClicked(juce::Button* button) override;
-        void comboBoxChanged(juce::ComboBox* comboBoxThatHasChanged) override;
+
+        // Preset browser and tags
+        void showPresetBrowser();
+        void showTagEditor();
+        void updatePresetButton();
 
         // Action menu handling
         void handleActionMenuResult(int result);
@@ -49,7 +59,8 @@ namespace Gui
 
         std::unique_ptr<juce::DrawableButton> actionButton;
         juce::TextButton previousPresetButton, nextPresetButton;
-        juce::ComboBox presetList;
+        juce::TextButton presetButton;
+        juce::Component::SafePointer<PresetBrowser> presetBrowser; ///< Open browser, if any
 
         std::unique_ptr<juce::FileChooser> fileChooser;
 
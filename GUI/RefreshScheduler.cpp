@@ -0,0 +1,43 @@
+/*
+  ==============================================================================
+
+    RefreshScheduler.cpp
+    Created: 19 Oct 2026 12:48:33am
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "RefreshScheduler.h"
+
+RefreshScheduler::RefreshScheduler(juce::Component& ownerToRefresh, FrameCallback onFrame)
+    : owner(ownerToRefresh),
+      frameCallback(std::move(onFrame)),
+      lastFrameMs(juce::Time::getMillisecondCounterHiRes()),
+      vBlankAttachment(&ownerToRefresh, [this] { handleVBlank(); })
+{
+    jassert(frameCallback != nullptr);
+}
+
+RefreshScheduler::~RefreshScheduler() = default;
+
+/**
+ * @brief Turns vertical blanks into frames at the rate the owner's visibility allows.
+ *
+ * A small tolerance keeps a 60 Hz display from skipping every other blank
+ * because of timing jitter.
+ */
+void RefreshScheduler::handleVBlank()
+{
+    const double nowMs = juce::Time::getMillisecondCounterHiRes();
+    const double rateHz = owner.isShowing() ? visibleRateHz : hiddenRateHz;
+    const double intervalMs = 1000.0 / rateHz;
+
+    if (nowMs - lastFrameMs < intervalMs * 0.9)
+        return;
+
+    const double elapsedSeconds = juce::jlimit(0.0, maxElapsedSeconds, (nowMs - lastFrameMs) / 1000.0);
+    lastFrameMs = nowMs;
+
+    frameCallback(elapsedSeconds);
+}
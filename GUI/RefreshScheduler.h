@@ -0,0 +1,59 @@
+/*
+  ==============================================================================
+
+    RefreshScheduler.h
+    Created: 19 Oct 2026 12:48:33am
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <functional>
+
+/**
+ * @class RefreshScheduler
+ * @brief Drives all GUI refreshes of one editor from the display's vertical blank.
+ *
+ * Components have no timers of their own: the owner gets a single callback per frame with
+ * the time since the previous one, and hands it on to whatever it shows. Frames
+ * are capped at visibleRateHz on fast displays and drop to hiddenRateHz while
+ * the owner is not showing, e.g. minimised or behind a closed host window.
+ */
+class RefreshScheduler
+{
+public:
+    /** Called once per frame with the seconds since the previous frame. */
+    using FrameCallback = std::function<void(double elapsedSeconds)>;
+
+    /**
+     * @brief Construct a new RefreshScheduler.
+     * @param owner   Component whose peer provides the vertical blank; must outlive the scheduler.
+     * @param onFrame Called on the message thread for every scheduled frame.
+     */
+    RefreshScheduler(juce::Component& owner, FrameCallback onFrame);
+
+    /** Destructor. Stops the callbacks. */
+    ~RefreshScheduler();
+
+    static constexpr double visibleRateHz = 60.0;   ///< Upper limit while showing
+    static constexpr double hiddenRateHz = 4.0;     ///< Rate while not showing
+
+    /** Longest step handed to the callback, so ballistics do not jump after a stall. */
+    static constexpr double maxElapsedSeconds = 0.25;
+
+private:
+    juce::Component& owner;
+    FrameCallback frameCallback;
+
+    double lastFrameMs = 0.0;   ///< Time of the last callback (ms)
+
+    /** Decides whether this vertical blank becomes a frame and runs the callback if so. */
+    void handleVBlank();
+
+    juce::VBlankAttachment vBlankAttachment;   ///< Declared last so it detaches first
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RefreshScheduler)
+};
@@ -83,13 +83,15 @@ void RotaryKnob::resized()
  * @brief Sets the alert level for the knob.
  *
  * The alert level is used by the LookAndFeel for visual feedback (e.g., color change).
- * Repaints the slider only if the new level differs from the current one by more than an epsilon.
+ * Repaints the slider only if the new level would change the blended arc colour by at least one step.
  *
  * @param newAlert The new alert level value.
  */
 void RotaryKnob::setAlertLevel(float newAlert)
 {
-    if (std::abs(newAlert - alertLevel) < 1e-6f)
+    // Always settle exactly on the ends so a fading alert does not leave a faint tint behind
+    const bool reachesEnd = newAlert != alertLevel && (newAlert <= 0.0f || newAlert >= 1.0f);
+    if (!reachesEnd && std::abs(newAlert - alertLevel) < 1.0f / 255.0f)
         return;
 
     alertLevel = newAlert;
@@ -0,0 +1,108 @@
+/*
+  ==============================================================================
+
+    SnapshotBar.cpp
+    Created: 19 Oct 2026 3:02:55am
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "SnapshotBar.h"
+#include "../LookAndFeel/PresetPanelLAF.h"
+#include "../LookAndFeel/Colors.h"
+#include "../LookAndFeel/Fonts.h"
+
+namespace Gui
+{
+    SnapshotBar::SnapshotBar(Service::SnapshotBank& bank)
+        : snapshotBank(bank)
+    {
+        for (int slot = 0; slot < Service::SnapshotBank::numSlots; ++slot)
+        {
+            auto& button = slotButtons[(size_t)slot];
+            button.setButtonText(Service::SnapshotBank::getSlotName(slot));
+            button.setMouseCursor(juce::MouseCursor::PointingHandCursor);
+            button.onClick = [this, slot] { selectSlot(slot); };
+            addAndMakeVisible(button);
+        }
+
+        morphLabel.setFont(Fonts::getFont(12.0f));
+        morphLabel.setColour(juce::Label::textColourId, Colors::PresetPanel::text);
+        morphLabel.setJustificationType(juce::Justification::centred);
+        addAndMakeVisible(morphLabel);
+
+        morphSlider.setRange(0.0, 1.0);
+        morphSlider.setMouseCursor(juce::MouseCursor::PointingHandCursor);
+        morphSlider.setColour(juce::Slider::trackColourId, Colors::PresetPanel::buttonHover);
+        morphSlider.setColour(juce::Slider::backgroundColourId, Colors::PresetPanel::boxBackground);
+        morphSlider.setColour(juce::Slider::thumbColourId, Colors::PresetPanel::text);
+        morphSlider.onValueChange = [this]
+        {
+            snapshotBank.morph((float)morphSlider.getValue());
+            updateFromBank();
+        };
+
+        // A whole drag is one edit for the host
+        morphSlider.onDragStart = [this] { snapshotBank.beginMorphGesture(); };
+        morphSlider.onDragEnd = [this] { snapshotBank.endMorphGesture(); };
+        addAndMakeVisible(morphSlider);
+
+        setLookAndFeel(PresetPanelLookAndFeel::get());
+        updateFromBank();
+    }
+
+    SnapshotBar::~SnapshotBar()
+    {
+        // The editor may close during a drag
+        snapshotBank.endMorphGesture();
+        setLookAndFeel(nullptr);
+    }
+
+    //==============================================================================
+    void SnapshotBar::resized()
+    {
+        const int reduce = 4;
+        auto area = getLocalBounds().reduced(reduce);
+
+        const int buttonWidth = area.getHeight();
+        for (auto& button : slotButtons)
+            button.setBounds(area.removeFromLeft(buttonWidth + reduce).withTrimmedRight(reduce));
+
+        morphLabel.setBounds(area.removeFromLeft(44));
+        morphSlider.setBounds(area);
+    }
+
+    //==============================================================================
+    void SnapshotBar::selectSlot(int slot)
+    {
+        snapshotBank.selectSlot(slot);
+        updateFromBank();
+    }
+
+    void SnapshotBar::updateFromBank()
+    {
+        const int activeSlot = snapshotBank.getActiveSlot();
+
+        for (int slot = 0; slot < Service::SnapshotBank::numSlots; ++slot)
+        {
+            const auto colour = slot == activeSlot ? Colors::PresetPanel::buttonHover
+                : snapshotBank.isStored(slot) ? Colors::PresetPanel::buttonBase
+                : Colors::PresetPanel::boxBackground;
+
+            slotButtons[(size_t)slot].setColour(juce::TextButton::buttonColourId, colour);
+        }
+
+        const int source = snapshotBank.getMorphSource();
+        const int target = snapshotBank.getMorphTarget();
+        const bool canMorph = source != target && snapshotBank.isStored(source) && snapshotBank.isStored(target);
+
+        morphLabel.setText(canMorph ? Service::SnapshotBank::getSlotName(source) + " - "
+            + Service::SnapshotBank::getSlotName(target) : juce::String("Morph"), juce::dontSendNotification);
+        morphSlider.setEnabled(canMorph);
+
+        // A selected slot is the target end of the morph
+        if (activeSlot >= 0)
+            morphSlider.setValue(1.0, juce::dontSendNotification);
+    }
+} // namespace Gui
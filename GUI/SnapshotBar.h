@@ -0,0 +1,53 @@
+/*
+  ==============================================================================
+
+    SnapshotBar.h
+    Created: 19 Oct 2026 3:02:55am
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include "../Service/SnapshotBank.h"
+
+namespace Gui
+{
+    /**
+     * @class SnapshotBar
+     * @brief A/B/C/D slot buttons and a morph slider for a SnapshotBank.
+     *
+     * Clicking a slot stores the current settings in it if it is empty and recalls it
+     * otherwise. The slider morphs between the two slots selected last.
+     */
+    class SnapshotBar : public juce::Component
+    {
+    public:
+        /**
+         * @brief Construct a new SnapshotBar.
+         * @param bank The processor's snapshot slots; must outlive the bar.
+         */
+        explicit SnapshotBar(Service::SnapshotBank& bank);
+        ~SnapshotBar() override;
+
+        void resized() override;
+
+    private:
+        /** Selects a slot and shows the new state. */
+        void selectSlot(int slot);
+
+        /** Updates the button colours, the morph label and the slider from the bank. */
+        void updateFromBank();
+
+        Service::SnapshotBank& snapshotBank;
+
+        std::array<juce::TextButton, Service::SnapshotBank::numSlots> slotButtons;
+        juce::Label morphLabel;
+        juce::Slider morphSlider{ juce::Slider::LinearHorizontal, juce::Slider::NoTextBox };
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SnapshotBar)
+    };
+}
@@ -0,0 +1,134 @@
+/*
+  ==============================================================================
+
+    SpectrumDisplay.cpp
+    Created: 18 Oct 2026 10:31:09pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "SpectrumDisplay.h"
+#include "../LookAndFeel/Colors.h"
+#include "../LookAndFeel/Fonts.h"
+
+SpectrumDisplay::SpectrumDisplay(SpectrumAnalyzer& analyzerToShow)
+    : analyzer(analyzerToShow)
+{
+    setOpaque(true);
+    preSpectrum.fill(mindB);
+    postSpectrum.fill(mindB);
+}
+
+SpectrumDisplay::~SpectrumDisplay() = default;
+
+void SpectrumDisplay::refresh()
+{
+    const auto version = analyzer.getVersion();
+    if (version == shownVersion)
+        return;
+
+    shownVersion = version;
+    analyzer.getSpectra(preSpectrum, postSpectrum);
+    rebuildPaths();
+    repaint(plotArea);
+}
+
+void SpectrumDisplay::setLowCutFrequency(float frequency)
+{
+    if (frequency == lowCutFrequency)
+        return;
+
+    lowCutFrequency = frequency;
+    repaint(plotArea);
+}
+
+/**
+ * @brief Paints the display.
+ *
+ * The spectra come from cached paths, so the cost does not depend on the
+ * FFT size or the number of display points.
+ */
+void SpectrumDisplay::paint(juce::Graphics& g)
+{
+    g.fillAll(Colors::LevelMeter::background);
+
+    g.setFont(Fonts::getFont(11.0f));
+
+    // Decade lines with labels
+    for (float frequency : { 100.0f, 1000.0f, 10000.0f })
+    {
+        const float x = xForFrequency(frequency);
+        g.setColour(Colors::LevelMeter::tickLine.withAlpha(0.25f));
+        g.drawVerticalLine(juce::roundToInt(x), (float)plotArea.getY(), (float)plotArea.getBottom());
+
+        g.setColour(Colors::LevelMeter::tickLabel);
+        g.drawText(frequency < 1000.0f ? juce::String(int(frequency)) : juce::String(int(frequency / 1000.0f)) + "k",
+            juce::roundToInt(x) + 2, plotArea.getBottom() - 13, 30, 12, juce::Justification::centredLeft);
+    }
+
+    g.setColour(Colors::Spectrum::pre.withAlpha(0.6f));
+    g.fillPath(prePath);
+
+    g.setColour(Colors::Spectrum::post);
+    g.strokePath(postPath, juce::PathStrokeType(1.2f));
+
+    if (lowCutFrequency > 0.0f)
+    {
+        const float x = xForFrequency(lowCutFrequency);
+        g.setColour(Colors::Spectrum::lowCut);
+        g.drawVerticalLine(juce::roundToInt(x), (float)plotArea.getY(), (float)plotArea.getBottom());
+        g.drawText(juce::String(juce::roundToInt(lowCutFrequency)) + " Hz",
+            juce::roundToInt(x) + 3, plotArea.getY() + 2, 60, 12, juce::Justification::centredLeft);
+    }
+
+    g.setColour(Colors::LevelMeter::border);
+    g.drawRoundedRectangle(getLocalBounds().toFloat().reduced(0.5f), 4.0f, 1.0f);
+}
+
+void SpectrumDisplay::resized()
+{
+    plotArea = getLocalBounds().reduced(2);
+    rebuildPaths();
+}
+
+float SpectrumDisplay::xForFrequency(float frequency) const noexcept
+{
+    const float proportion = std::log(frequency / SpectrumAnalyzer::minFrequency)
+        / std::log(SpectrumAnalyzer::maxFrequency / SpectrumAnalyzer::minFrequency);
+
+    return plotArea.getX() + juce::jlimit(0.0f, 1.0f, proportion) * plotArea.getWidth();
+}
+
+float SpectrumDisplay::yForLevel(float db) const noexcept
+{
+    return juce::jmap(juce::jlimit(mindB, maxdB, db), maxdB, mindB, (float)plotArea.getY(), (float)plotArea.getBottom());
+}
+
+void SpectrumDisplay::rebuildPaths()
+{
+    prePath.clear();
+    postPath.clear();
+
+    if (plotArea.isEmpty())
+        return;
+
+    const float bottom = (float)plotArea.getBottom();
+
+    prePath.startNewSubPath(xForFrequency(SpectrumAnalyzer::getPointFrequency(0)), bottom);
+
+    for (int point = 0; point < SpectrumAnalyzer::numPoints; ++point)
+    {
+        const float x = xForFrequency(SpectrumAnalyzer::getPointFrequency(point));
+
+        prePath.lineTo(x, yForLevel(preSpectrum[(size_t)point]));
+
+        if (point == 0)
+            postPath.startNewSubPath(x, yForLevel(postSpectrum[(size_t)point]));
+        else
+            postPath.lineTo(x, yForLevel(postSpectrum[(size_t)point]));
+    }
+
+    prePath.lineTo(xForFrequency(SpectrumAnalyzer::maxFrequency), bottom);
+    prePath.closeSubPath();
+}
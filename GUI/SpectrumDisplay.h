@@ -0,0 +1,76 @@
+/*
+  ==============================================================================
+
+    SpectrumDisplay.h
+    Created: 18 Oct 2026 10:31:09pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "../Service/SpectrumAnalyzer.h"
+
+/**
+ * @class SpectrumDisplay
+ * @brief Pre/post spectrum with a marker at the current low cut frequency.
+ *
+ * Activates the analyzer for as long as the display exists. Spectra are
+ * turned into cached paths only when the analyzer publishes a new version
+ * or the component is resized; paint() just fills and strokes the paths.
+ */
+class SpectrumDisplay : public juce::Component
+{
+public:
+    /**
+     * @brief Construct a new SpectrumDisplay and start the analysis.
+     * @param analyzer The processor's analyzer; must outlive the component.
+     */
+    explicit SpectrumDisplay(SpectrumAnalyzer& analyzer);
+
+    /** Stops the analysis. */
+    ~SpectrumDisplay() override;
+
+    /** Picks up newly published spectra and repaints if there were any. */
+    void refresh();
+
+    /**
+     * @brief Moves the low cut marker.
+     * @param frequency Cutoff in Hz.
+     */
+    void setLowCutFrequency(float frequency);
+
+    /** Draws the grid, both spectra and the low cut marker. */
+    void paint(juce::Graphics&) override;
+
+    /** Rebuilds the paths for the new size. */
+    void resized() override;
+
+    static constexpr float maxdB = 0.0f;     ///< Top of the display
+    static constexpr float mindB = -90.0f;   ///< Bottom of the display
+
+private:
+    SpectrumAnalyzer& analyzer;
+
+    SpectrumAnalyzer::Spectrum preSpectrum{};
+    SpectrumAnalyzer::Spectrum postSpectrum{};
+    juce::uint32 shownVersion = 0;
+
+    juce::Path prePath;          ///< Closed area under the input spectrum
+    juce::Path postPath;         ///< Open line of the output spectrum
+    juce::Rectangle<int> plotArea;
+    float lowCutFrequency = 0.0f;
+
+    /** @return X position of a frequency inside plotArea. */
+    float xForFrequency(float frequency) const noexcept;
+
+    /** @return Y position of a level inside plotArea. */
+    float yForLevel(float db) const noexcept;
+
+    /** Rebuilds prePath and postPath from the stored spectra. */
+    void rebuildPaths();
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SpectrumDisplay)
+};
@@ -0,0 +1,149 @@
+/*
+  ==============================================================================
+
+    TransferCurve.cpp
+    Created: 18 Oct 2026 11:24:15pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "TransferCurve.h"
+#include "../LookAndFeel/Colors.h"
+#include "../LookAndFeel/Fonts.h"
+
+TransferCurve::TransferCurve()
+{
+    setOpaque(true);
+}
+
+TransferCurve::~TransferCurve() = default;
+
+void TransferCurve::setParameters(float newCompression, float newControl, float newOutputGainDb)
+{
+    if (newCompression == compression && newControl == control && newOutputGainDb == outputGainDb)
+        return;
+
+    compression = newCompression;
+    control = newControl;
+    outputGainDb = newOutputGainDb;
+    mapping = CompressorMapping::fromControls(compression, control);
+
+    rebuildCurve();
+    repaint();
+}
+
+/**
+ * @brief Places the dot on the curve at the current input level.
+ *
+ * Sub-pixel moves are ignored so a steady signal causes no repaints at all.
+ */
+void TransferCurve::setInputLevel(float drivenRms)
+{
+    const bool audible = drivenRms > juce::Decibels::decibelsToGain(mindB + mapping.inputGainDb);
+
+    juce::Point<float> point;
+    if (audible)
+    {
+        const float inputDb = juce::Decibels::gainToDecibels(drivenRms) - mapping.inputGainDb;
+        point = toPixels(inputDb, transfer(inputDb));
+    }
+
+    if (audible == hasOperatingPoint
+        && (!audible || (std::abs(point.x - operatingPoint.x) < 0.5f && std::abs(point.y - operatingPoint.y) < 0.5f)))
+        return;
+
+    if (hasOperatingPoint)
+        repaint(getDotBounds());
+
+    hasOperatingPoint = audible;
+    operatingPoint = point;
+
+    if (hasOperatingPoint)
+        repaint(getDotBounds());
+}
+
+void TransferCurve::paint(juce::Graphics& g)
+{
+    g.fillAll(Colors::LevelMeter::background);
+
+    g.setColour(Colors::LevelMeter::tickLine.withAlpha(0.25f));
+    for (float db = maxdB - stepdB * 0.5f; db > mindB; db -= stepdB)
+    {
+        const auto corner = toPixels(db, db);
+        g.drawVerticalLine(juce::roundToInt(corner.x), (float)plotArea.getY(), (float)plotArea.getBottom());
+        g.drawHorizontalLine(juce::roundToInt(corner.y), (float)plotArea.getX(), (float)plotArea.getRight());
+    }
+
+    // Unity reference
+    g.drawLine(juce::Line<float>(toPixels(mindB, mindB), toPixels(maxdB, maxdB)), 1.0f);
+
+    g.setColour(Colors::Group::label);
+    g.strokePath(curve, juce::PathStrokeType(1.5f));
+
+    if (hasOperatingPoint)
+    {
+        g.setColour(Colors::Knob::dial);
+        g.fillEllipse(operatingPoint.x - dotRadius, operatingPoint.y - dotRadius, 2.0f * dotRadius, 2.0f * dotRadius);
+    }
+
+    g.setColour(Colors::LevelMeter::border);
+    g.drawRoundedRectangle(getLocalBounds().toFloat().reduced(0.5f), 4.0f, 1.0f);
+
+    g.setFont(Fonts::getFont(11.0f));
+    g.setColour(Colors::LevelMeter::tickLabel);
+    g.drawText("In / Out", plotArea.reduced(4, 2), juce::Justification::bottomRight);
+}
+
+void TransferCurve::resized()
+{
+    // Square plot so both axes share one dB scale
+    const int side = juce::jmin(getWidth(), getHeight()) - 4;
+    plotArea = getLocalBounds().withSizeKeepingCentre(side, side);
+    rebuildCurve();
+}
+
+void TransferCurve::rebuildCurve()
+{
+    curve.clear();
+
+    if (plotArea.isEmpty())
+        return;
+
+    // One vertex per pixel column is plenty for piecewise-linear dB segments
+    const int numVertices = plotArea.getWidth() + 1;
+
+    for (int i = 0; i < numVertices; ++i)
+    {
+        const float inputDb = juce::jmap((float)i, 0.0f, (float)(numVertices - 1), mindB, maxdB);
+        const auto point = toPixels(inputDb, transfer(inputDb));
+
+        if (i == 0)
+            curve.startNewSubPath(point);
+        else
+            curve.lineTo(point);
+    }
+}
+
+float TransferCurve::transfer(float inputDb) const noexcept
+{
+    return mapping.getStaticOutputDb(inputDb) + outputGainDb;
+}
+
+juce::Point<float> TransferCurve::toPixels(float inputDb, float outputDb) const noexcept
+{
+    const float x = juce::jmap(juce::jlimit(mindB, maxdB, inputDb), mindB, maxdB,
+        (float)plotArea.getX(), (float)plotArea.getRight());
+    const float y = juce::jmap(juce::jlimit(mindB, maxdB, outputDb), mindB, maxdB,
+        (float)plotArea.getBottom(), (float)plotArea.getY());
+
+    return { x, y };
+}
+
+juce::Rectangle<int> TransferCurve::getDotBounds() const noexcept
+{
+    return juce::Rectangle<float>(2.0f * dotRadius, 2.0f * dotRadius)
+        .withCentre(operatingPoint)
+        .expanded(1.0f)
+        .getSmallestIntegerContainer();
+}
@@ -0,0 +1,85 @@
+/*
+  ==============================================================================
+
+    TransferCurve.h
+    Created: 18 Oct 2026 11:24:15pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "../DSP/CompressorMapping.h"
+
+/**
+ * @class TransferCurve
+ * @brief Static input/output curve of both compressor stages with a live operating point.
+ *
+ * The curve is computed analytically from CompressorMapping on the message
+ * thread and cached as a path; it is only rebuilt when the knobs or the size
+ * change. The operating point follows the measured input level and repaints
+ * only its own small area, and only when it actually moves.
+ */
+class TransferCurve : public juce::Component
+{
+public:
+    /** Construct a new TransferCurve. */
+    TransferCurve();
+
+    /** Destructor. */
+    ~TransferCurve() override;
+
+    /**
+     * @brief Updates the curve for new knob positions. Does nothing if they are unchanged.
+     * @param compression  Compression parameter (1...100).
+     * @param control      Control parameter (1...100).
+     * @param outputGainDb Output gain in dB.
+     */
+    void setParameters(float compression, float control, float outputGainDb);
+
+    /**
+     * @brief Moves the operating point.
+     * @param drivenRms Linear RMS measured after the input gain, as carried by the telemetry.
+     */
+    void setInputLevel(float drivenRms);
+
+    /** Draws the grid, the cached curve and the operating point. */
+    void paint(juce::Graphics&) override;
+
+    /** Rebuilds the curve for the new size. */
+    void resized() override;
+
+    static constexpr float mindB = -60.0f;   ///< Lower end of both axes
+    static constexpr float maxdB = 6.0f;     ///< Upper end of both axes
+    static constexpr float stepdB = 12.0f;   ///< Grid spacing
+
+private:
+    CompressorMapping mapping;
+    float compression = -1.0f;       ///< Knob positions the curve was built for
+    float control = -1.0f;
+    float outputGainDb = 0.0f;
+
+    juce::Path curve;                ///< Cached transfer curve in pixels
+    juce::Rectangle<int> plotArea;
+
+    bool hasOperatingPoint = false;
+    juce::Point<float> operatingPoint;
+
+    static constexpr float dotRadius = 3.0f;
+
+    /** Rebuilds the cached path from the mapping. */
+    void rebuildCurve();
+
+    /** @return Output level in dBFS for an input level in dBFS, including the output gain. */
+    float transfer(float inputDb) const noexcept;
+
+    /** @return Pixel position of an input/output level pair. */
+    juce::Point<float> toPixels(float inputDb, float outputDb) const noexcept;
+
+    /** @return Area covered by the operating point dot. */
+    juce::Rectangle<int> getDotBounds() const noexcept;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TransferCurve)
+};
@@ -0,0 +1,106 @@
+/*
+  ==============================================================================
+
+    WaveformOverview.cpp
+    Created: 18 Oct 2026 9:15:40pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "WaveformOverview.h"
+#include "../LookAndFeel/Colors.h"
+#include "../LookAndFeel/Fonts.h"
+
+WaveformOverview::WaveformOverview(const WaveformPyramid& pyramidToShow)
+    : pyramid(pyramidToShow)
+{
+    setOpaque(true);
+}
+
+WaveformOverview::~WaveformOverview() = default;
+
+void WaveformOverview::refresh()
+{
+    if (columns.empty())
+        return;
+
+    // A stopped transport or a long window often yields the same columns as last frame
+    pyramid.render(windowSeconds, rendered);
+    if (rendered == columns)
+        return;
+
+    columns.swap(rendered);
+    repaint(plotArea);
+}
+
+/**
+ * @brief Paints the overlay: input envelope first, output on top.
+ */
+void WaveformOverview::paint(juce::Graphics& g)
+{
+    g.fillAll(Colors::LevelMeter::background);
+
+    g.setColour(Colors::LevelMeter::tickLine.withAlpha(0.25f));
+    g.drawHorizontalLine(plotArea.getCentreY(), (float)plotArea.getX(), (float)plotArea.getRight());
+
+    drawEnvelope(g, true, Colors::Waveform::input);
+    drawEnvelope(g, false, Colors::Waveform::output);
+
+    g.setColour(Colors::LevelMeter::border);
+    g.drawRoundedRectangle(getLocalBounds().toFloat().reduced(0.5f), 4.0f, 1.0f);
+
+    g.setFont(Fonts::getFont(11.0f));
+    g.setColour(Colors::LevelMeter::tickLabel);
+    g.drawText(juce::String(juce::roundToInt(windowSeconds)) + " s", plotArea.reduced(4, 2),
+        juce::Justification::bottomLeft);
+}
+
+void WaveformOverview::resized()
+{
+    plotArea = getLocalBounds().reduced(2);
+    columns.assign((size_t)juce::jmax(0, plotArea.getWidth()), WaveformPyramid::Column{});
+    rendered.assign(columns.size(), WaveformPyramid::Column{});
+}
+
+void WaveformOverview::mouseDown(const juce::MouseEvent&)
+{
+    static constexpr double lengths[] = { 2.0, 5.0, 10.0, 30.0 };
+
+    double next = lengths[0];
+    for (auto length : lengths)
+    {
+        if (length > windowSeconds + 1.0e-6)
+        {
+            next = length;
+            break;
+        }
+    }
+
+    windowSeconds = next;
+    refresh();
+    repaint();
+}
+
+void WaveformOverview::drawEnvelope(juce::Graphics& g, bool input, juce::Colour colour) const
+{
+    const float centre = (float)plotArea.getCentreY();
+    const float halfHeight = plotArea.getHeight() * 0.5f;
+    const float top = (float)plotArea.getY();
+    const float bottom = (float)plotArea.getBottom();
+
+    g.setColour(colour);
+
+    for (size_t x = 0; x < columns.size(); ++x)
+    {
+        const auto& range = input ? columns[x].input : columns[x].output;
+        if (range.isEmpty())
+            continue;
+
+        const float yTop = juce::jlimit(top, bottom, centre - range.max * halfHeight);
+        const float yBottom = juce::jlimit(top, bottom, centre - range.min * halfHeight);
+
+        // Keep near-silent stretches visible as a one-pixel trace
+        g.drawVerticalLine(plotArea.getX() + (int)x, yTop, juce::jmax(yBottom, yTop + 1.0f));
+    }
+}
@@ -0,0 +1,67 @@
+/*
+  ==============================================================================
+
+    WaveformOverview.h
+    Created: 18 Oct 2026 9:15:40pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <vector>
+#include "../Service/WaveformPyramid.h"
+
+/**
+ * @class WaveformOverview
+ * @brief Input-versus-output waveform overlay of the last few seconds.
+ *
+ * Pulls one min/max column per pixel from a WaveformPyramid on refresh()
+ * and draws the input envelope behind the output envelope, so the effect of
+ * the compression on the signal shape is visible at a glance. Clicking the
+ * view cycles through the window lengths.
+ */
+class WaveformOverview : public juce::Component
+{
+public:
+    /**
+     * @brief Construct a new WaveformOverview.
+     * @param pyramid Source of the waveform history; must outlive the component.
+     */
+    explicit WaveformOverview(const WaveformPyramid& pyramid);
+
+    /** Destructor. */
+    ~WaveformOverview() override;
+
+    /** Fetches the newest columns from the pyramid and repaints if any of them changed. */
+    void refresh();
+
+    /** Draws both envelopes, one vertical line per pixel and signal. */
+    void paint(juce::Graphics&) override;
+
+    /** Resizes the column buffer to the new width. */
+    void resized() override;
+
+    /** Cycles through the window lengths. */
+    void mouseDown(const juce::MouseEvent&) override;
+
+private:
+    const WaveformPyramid& pyramid;
+
+    std::vector<WaveformPyramid::Column> columns;   ///< One entry per plot pixel
+    std::vector<WaveformPyramid::Column> rendered;  ///< Scratch for the next refresh, same size
+    juce::Rectangle<int> plotArea;
+    double windowSeconds = 5.0;
+
+    /**
+     * @brief Draws one signal's envelope.
+     * @param g      Graphics context to draw into.
+     * @param input  True for the input envelope, false for the output.
+     * @param colour Fill colour.
+     */
+    void drawEnvelope(juce::Graphics& g, bool input, juce::Colour colour) const;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WaveformOverview)
+};
@@ -71,6 +71,19 @@ namespace Colors
 
     }
 
+    namespace Waveform
+    {
+        const juce::Colour input{ 30, 120, 60 };                   // forest green
+        const juce::Colour output{ 50, 200, 180 };                 // aqua green
+    }
+
+    namespace Spectrum
+    {
+        const juce::Colour pre{ 30, 120, 60 };                     // forest green
+        const juce::Colour post{ 50, 200, 180 };                   // aqua green
+        const juce::Colour lowCut{ 255, 140, 60 };                 // orange
+    }
+
     namespace Slider
     {
         const juce::Colour sliderFill{ 160, 70, 220 };             // violet
@@ -17,10 +17,9 @@
 /**
  * @brief Paints the full Gain Reduction meter: frame, bar and tick labels.
  *
- * Renders the meter background/border, a single horizontal GR bar, and evenly
- * spaced dB tick marks with numeric labels. Geometry is snapped to integers for
- * crisp 1-px lines. Uses the meter's mapping function to convert dB values to
- * pixel X positions.
+ * The meter background/border and the dB tick marks with numeric labels come
+ * from images cached per size and scale factor; only the single horizontal GR
+ * bar is drawn per frame, as an integer rectangle.
  *
  * @param g      Graphics context to draw into.
  * @param meter  Source of layout and dB->pixel mapping (positionForLevel).
@@ -28,53 +27,81 @@
 void GainReductionMeterLookAndFeel::drawGainReductionMeter(juce::Graphics& g,
     const GainReductionMeter& meter) noexcept
 {
-    const auto  font = Fonts::getFont(tickFontHeight);
+    const auto& layers = layerCache.get(meter.getWidth(), meter.getHeight(),
+        quantiseLayerScale(g.getInternalContext().getPhysicalPixelScaleFactor()),
+        [this, &meter](MeterLayers& newLayers) { buildLayers(newLayers, meter); });
+
+    const auto bounds = meter.getLocalBounds().toFloat();
+    g.drawImage(layers.background, bounds, juce::RectanglePlacement::stretchToFit);
+
+    // Draw the GR bar (thin RMS-style bar that reflects current max GR level)
+    const int w = layers.barRight - layers.barLeft;
+    if (w > 0)
+        drawRmsLevel(layers.barLeft, layers.barTop, w, rmsHeight, g, meter.getMaxRmsLevel(), layers.dbScale);
+
+    g.drawImage(layers.overlay, bounds, juce::RectanglePlacement::stretchToFit);
+}
+
+/**
+ * @brief Renders the static parts of a meter once for its size and scale.
+ *
+ * Geometry is snapped to integers for crisp 1-px lines.
+ *
+ * @param layers  Entry to fill; its size and scale are already set.
+ * @param meter   Meter providing the dB -> pixel mapping.
+ */
+void GainReductionMeterLookAndFeel::buildLayers(MeterLayers& layers, const GainReductionMeter& meter) const
+{
     constexpr float borderThickness = 1.0f;
     constexpr float borderRadius = 4.0f;
 
-    const auto borderRect = meter.getLocalBounds().toFloat().reduced(7.0f);
-    const auto innerRect = borderRect.reduced(10.0f);
+    const auto borderRect = juce::Rectangle<float>((float)layers.width, (float)layers.height).reduced(borderInset);
+    const auto innerRect = borderRect.reduced(barPadding);
 
-    g.fillAll(Colors::LevelMeter::background);
-    g.setColour(Colors::LevelMeter::border);
-    g.drawRoundedRectangle(borderRect, borderRadius, borderThickness);
-    g.setFont(font);
+    layers.barLeft = juce::roundToInt(innerRect.getX());
+    layers.barRight = juce::roundToInt(innerRect.getRight());
+    layers.barTop = juce::roundToInt(innerRect.getY());
 
-    // Bar settings
-    constexpr int rmsHeight = 4;
+    const int xLeft = layers.barLeft;
+    const int xRight = layers.barRight;
 
-    // Snap geometry to integers for crisp 1-px lines
-    const int xLeft = juce::roundToInt(innerRect.getX());
-    const int xRight = juce::roundToInt(innerRect.getRight());
-    const int yTop = juce::roundToInt(innerRect.getY());
-    const int w = xRight - xLeft;
-    if (w <= 0) return;
+    layers.dbScale.prepare(GainReductionMeter::mindB, GainReductionMeter::maxdB,
+        [xLeft, xRight, &meter](float db) { return meter.positionForLevel(db, (float)xLeft, (float)xRight); });
 
-    /// Mapper: dB -> pixel x
-    const auto map = [xLeft, xRight, &meter](float db) noexcept -> int
+    layers.background = layers.renderLayer([&](juce::Graphics& g)
         {
-            return meter.positionForLevel(db, xLeft, xRight);
-        };
+            g.fillAll(Colors::LevelMeter::background);
+            g.setColour(Colors::LevelMeter::border);
+            g.drawRoundedRectangle(borderRect, borderRadius, borderThickness);
+        });
 
-    // Draw the GR bar (thin RMS-style bar that reflects current max GR level)
-    drawRmsLevel(xLeft, yTop, w, rmsHeight, g, meter.getMaxRmsLevel(), map);
-
-    // Ticks and labels
-    const int  tickTop = yTop + 2;  // 2 px down from top of inner rect
-    constexpr int tickHeight = 8;
-    const int  labelTop = tickTop + tickHeight;
-    constexpr int labelHeight = 12;
-    constexpr int labelWidth = 27;
-
-    for (float db = GainReductionMeter::maxdB;
-        db >= GainReductionMeter::mindB - 1.0e-3f;
-        db -= GainReductionMeter::stepdB)
+    if (xRight <= xLeft)
     {
-        const int x = map(db);
-        drawTickWithLabel(g, x, tickTop, tickHeight,
-            juce::String(int(db)),
-            labelTop, labelWidth, labelHeight);
+        layers.overlay = layers.renderLayer([](juce::Graphics&) {});
+        return;
     }
+
+    layers.overlay = layers.renderLayer([&](juce::Graphics& g)
+        {
+            g.setFont(Fonts::getFont(tickFontHeight));
+
+            // Ticks and labels
+            const int  tickTop = layers.barTop + 2;  // 2 px down from top of inner rect
+            constexpr int tickHeight = 8;
+            const int  labelTop = tickTop + tickHeight;
+            constexpr int labelHeight = 12;
+            constexpr int labelWidth = 27;
+
+            for (float db = GainReductionMeter::maxdB;
+                db >= GainReductionMeter::mindB - 1.0e-3f;
+                db -= GainReductionMeter::stepdB)
+            {
+                const int x = layers.dbScale.positionForLevel(db);
+                drawTickWithLabel(g, x, tickTop, tickHeight,
+                    juce::String(int(db)),
+                    labelTop, labelWidth, labelHeight);
+            }
+        });
 }
 
 /**
@@ -89,12 +116,12 @@ void GainReductionMeterLookAndFeel::drawGainReductionMeter(juce::Graphics& g,
  * @param height          Bar height in pixels.
  * @param g               Graphics context to draw into.
  * @param levelDB         Current gain-reduction level in dB (negative domain).
- * @param positionForLevel Callable mapping dB -> pixel X within [x, x + width].
+ * @param scale           Precomputed dB -> pixel X positions within [x, x + width].
  * @param fillColour      Colour used to fill the bar.
  */
 void GainReductionMeterLookAndFeel::drawMeterBar(
     int x, int y, int width, int height, juce::Graphics& g, float levelDB,
-    const std::function<int(float)>& positionForLevel, juce::Colour fillColour) noexcept
+    const MeterScale& scale, juce::Colour fillColour) noexcept
 {
     if (width <= 0 || height <= 0)
         return;
@@ -105,9 +132,9 @@ void GainReductionMeterLookAndFeel::drawMeterBar(
 
     // X of no reduction (typically the far right) and X of current GR
     const int xNoReduction = juce::jlimit(x, x + width,
-        positionForLevel(GainReductionMeter::maxdB));
+        scale.positionForLevel(GainReductionMeter::maxdB));
     const int xCurrentGR = juce::jlimit(x, x + width,
-        positionForLevel(clampedDB));
+        scale.positionForLevel(clampedDB));
 
     const int barStart = std::min(xNoReduction, xCurrentGR);
     const int barEnd = std::max(xNoReduction, xCurrentGR);
@@ -128,14 +155,14 @@ void GainReductionMeterLookAndFeel::drawMeterBar(
  * @param height          Bar height in pixels.
  * @param g               Graphics context to draw into.
  * @param levelDB         Current gain-reduction level in dB.
- * @param positionForLevel Callable mapping dB -> pixel X within [x, x + width].
+ * @param scale           Precomputed dB -> pixel X positions within [x, x + width].
  */
 void GainReductionMeterLookAndFeel::drawRmsLevel(
     int x, int y, int width, int height,
     juce::Graphics& g,
     float levelDB,
-    const std::function<int(float)>& positionForLevel) noexcept
+    const MeterScale& scale) noexcept
 {
-    drawMeterBar(x, y, width, height, g, levelDB, positionForLevel,
+    drawMeterBar(x, y, width, height, g, levelDB, scale,
         Colors::LevelMeter::gainReduction);
 }
@@ -31,13 +31,27 @@ public:
 
     void drawGainReductionMeter(juce::Graphics& g, const GainReductionMeter& meter) noexcept;
     void drawMeterBar(int x, int y, int width, int height, juce::Graphics& g, float levelDB,
-        const std::function<int(float)>& positionForLevel, juce::Colour fillColour) noexcept;
+        const MeterScale& scale, juce::Colour fillColour) noexcept;
     void drawRmsLevel(int x, int y, int width, int height,
         juce::Graphics& g,
         float levelDB,
-        const std::function<int(float)>& positionForLevel) noexcept;
+        const MeterScale& scale) noexcept;
+
+    /** Drops the cached meter layers, e.g. for benchmarking. */
+    void clearLayerCache() noexcept { layerCache.clear(); }
 
 private:
     const float clampdB = -120.0f;
+
+    // Bar layout, shared by the cached layers and the per-frame bar
+    static constexpr float borderInset = 7.0f;
+    static constexpr float barPadding = 10.0f;
+    static constexpr int rmsHeight = 4;
+
+    MeterLayerCache layerCache;
+
+    /** Renders background, border, ticks and labels and fills in the dB table. */
+    void buildLayers(MeterLayers& layers, const GainReductionMeter& meter) const;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(GainReductionMeterLookAndFeel)
 };
@@ -12,6 +12,7 @@
 
 #include <JuceHeader.h>
 #include "Colors.h"
+#include <vector>
 
 
 
@@ -44,3 +45,197 @@ namespace
     }
 }
 
+
+
+//==============================================================================
+// Layer caching
+
+/**
+ * @brief Rounds a physical scale factor up to the next quarter step.
+ *
+ * Cached layers are rendered at the rounded scale, so dragging the editor size
+ * only produces a handful of cache entries, each at least as sharp as the screen.
+ * @param scale Physical pixels per logical pixel of the target context.
+ * @return Scale to render and key the cached layer with.
+ */
+inline float quantiseLayerScale(float scale) noexcept
+{
+    return juce::jmax(0.25f, std::ceil(scale * 4.0f) / 4.0f);
+}
+
+/**
+ * @class LayerCache
+ * @brief A handful of rendered layers, looked up by key. Message thread only.
+ *
+ * Sizes and scales change rarely, so a full cache simply starts over: that keeps
+ * it bounded without any usage bookkeeping.
+ * @tparam Key   Everything the rendering depends on; compared with ==.
+ * @tparam Value What is cached for one key, e.g. a juce::Image.
+ */
+template <typename Key, typename Value>
+class LayerCache
+{
+public:
+    /**
+     * @brief Returns the value for a key, building it on a miss.
+     * @param build Called without arguments on a miss; returns the Value to store.
+     * @return Reference valid until the next call.
+     */
+    template <typename Build>
+    const Value& get(const Key& key, Build&& build)
+    {
+        for (const auto& [cachedKey, value] : entries)
+            if (cachedKey == key)
+                return value;
+
+        if (entries.size() >= maxEntries)
+            entries.clear();
+
+        entries.emplace_back(key, build());
+        return entries.back().second;
+    }
+
+    /** Drops every cached entry. */
+    void clear() noexcept { entries.clear(); }
+
+private:
+    std::vector<std::pair<Key, Value>> entries;
+    static constexpr size_t maxEntries = 8;   ///< A few styles times a few scale factors
+};
+
+/**
+ * @class MeterScale
+ * @brief Precomputed dB -> pixel X positions for one meter width.
+ *
+ * Built once per size from the meter's own mapping, so the bars land on exactly
+ * the pixels the mapping would give, without a call per bar and frame.
+ */
+class MeterScale
+{
+public:
+    static constexpr float resolutiondB = 0.05f;   ///< dB per table entry
+
+    /**
+     * @brief Fills the table.
+     * @param newMindB         Lowest level of the meter.
+     * @param newMaxdB         Highest level of the meter.
+     * @param positionForLevel Mapping from dB to pixel X, called once per entry.
+     */
+    template <typename Mapping>
+    void prepare(float newMindB, float newMaxdB, Mapping&& positionForLevel)
+    {
+        mindB = newMindB;
+        maxdB = newMaxdB;
+
+        const int numEntries = juce::roundToInt((maxdB - mindB) / resolutiondB) + 1;
+        positions.resize((size_t)numEntries);
+
+        for (int i = 0; i < numEntries; ++i)
+            positions[(size_t)i] = positionForLevel(mindB + (float)i * resolutiondB);
+    }
+
+    /**
+     * @brief Looks up the pixel X of a level.
+     * @param db Level in dB; clamped to the meter's range.
+     * @return Pixel X of the nearest table entry.
+     */
+    int positionForLevel(float db) const noexcept
+    {
+        jassert(!positions.empty());
+
+        const float clamped = juce::jlimit(mindB, maxdB, db);
+        const int index = juce::roundToInt((clamped - mindB) / resolutiondB);
+        return positions[(size_t)juce::jlimit(0, (int)positions.size() - 1, index)];
+    }
+
+private:
+    float mindB = 0.0f;
+    float maxdB = 0.0f;
+    std::vector<int> positions;
+};
+
+/**
+ * @struct MeterLayers
+ * @brief The static parts of one meter at one size and scale factor.
+ *
+ * Background and border go under the bars, ticks and labels over them, so
+ * the painted result matches drawing everything in order.
+ */
+struct MeterLayers
+{
+    int width = 0;              ///< Logical size the layers were built for
+    int height = 0;
+    float scale = 1.0f;         ///< Physical pixels per logical pixel
+
+    juce::Image background;     ///< Fill and border, drawn under the bars
+    juce::Image overlay;        ///< Ticks and labels, drawn over the bars
+
+    MeterScale dbScale;         ///< dB -> pixel X of the bar area
+    int barLeft = 0;            ///< Bar area in logical pixels
+    int barRight = 0;
+    int barTop = 0;
+
+    /**
+     * @brief Renders one layer at physical resolution.
+     * @param draw Called with a context in logical coordinates.
+     * @return Transparent ARGB image with the drawing.
+     */
+    template <typename Draw>
+    juce::Image renderLayer(Draw&& draw) const
+    {
+        juce::Image image(juce::Image::ARGB,
+            juce::jmax(1, juce::roundToInt((float)width * scale)),
+            juce::jmax(1, juce::roundToInt((float)height * scale)), true);
+
+        juce::Graphics g(image);
+        g.addTransform(juce::AffineTransform::scale(scale));
+        draw(g);
+
+        return image;
+    }
+};
+
+/**
+ * @class MeterLayerCache
+ * @brief A few MeterLayers, looked up by size and scale. Message thread only.
+ */
+class MeterLayerCache
+{
+public:
+    /**
+     * @brief Returns the layers for a size and scale, building them on a miss.
+     * @param build Called with a MeterLayers whose size and scale are set; fills in the rest.
+     * @return Reference valid until the next call.
+     */
+    template <typename Build>
+    const MeterLayers& get(int width, int height, float scale, Build&& build)
+    {
+        return cache.get({ width, height, scale }, [&]
+        {
+            MeterLayers layers;
+            layers.width = width;
+            layers.height = height;
+            layers.scale = scale;
+            build(layers);
+            return layers;
+        });
+    }
+
+    /** Drops every cached entry. */
+    void clear() noexcept { cache.clear(); }
+
+private:
+    struct Key
+    {
+        int width = 0;
+        int height = 0;
+        float scale = 1.0f;
+
+        bool operator==(const Key& other) const noexcept
+        {
+            return width == other.width && height == other.height && scale == other.scale;
+        }
+    };
+
+    LayerCache<Key, MeterLayers> cache;
+};
@@ -20,72 +20,91 @@
  * @param g       The JUCE graphics context to use for rendering.
  * @param meter   Reference to the LevelMeter component providing measurement data and scale mapping.
  *
- * @note This method draws both channels' peak and RMS meters, applies background/border styling,
- *       and places dB tick marks along the scale.
+ * @note Background, border, ticks and labels come from images cached per size and scale
+ *       factor; only the four bars are drawn per frame, as integer rectangles.
  */
 void LevelMeterLookAndFeel::drawLevelMeter(juce::Graphics& g, const LevelMeter& meter) noexcept
 {
-    const auto font = Fonts::getFont(tickFontHeight);
-    constexpr float borderThickness = 1.0f;
-    constexpr float borderRadius = 4.0f;
+    const auto& layers = layerCache.get(meter.getWidth(), meter.getHeight(),
+        quantiseLayerScale(g.getInternalContext().getPhysicalPixelScaleFactor()),
+        [this, &meter](MeterLayers& newLayers) { buildLayers(newLayers, meter); });
 
-    const auto borderRect = meter.getLocalBounds().toFloat().reduced(7.0f);
-    const auto innerRect = borderRect.reduced(10.0f);
+    const auto bounds = meter.getLocalBounds().toFloat();
+    g.drawImage(layers.background, bounds, juce::RectanglePlacement::stretchToFit);
 
-    // Draw background and border
-    g.fillAll(Colors::LevelMeter::background);
-    g.setColour(Colors::LevelMeter::border);
-    g.drawRoundedRectangle(borderRect, borderRadius, borderThickness);
-    g.setFont(font);
+    const int w = layers.barRight - layers.barLeft;
 
-    // Bar layout configuration
-    constexpr int barHeight = 7;
-    constexpr int rmsHeight = 4;
-    constexpr int barSpacing = 2; // space between bars
+    if (w > 0)
+    {
+        // Calculate bar Y positions
+        const int yPeakL = layers.barTop;
+        const int yPeakR = yPeakL + barHeight + barSpacing;
 
-    // Calculate bar X geometry
-    const int xLeft = juce::roundToInt(innerRect.getX());
-    const int xRight = juce::roundToInt(innerRect.getRight());
-    const int w = xRight - xLeft;
+        drawPeakLevel(layers.barLeft, yPeakL, w, barHeight, g, meter.getPeakLevelL(), layers.dbScale);
+        drawPeakLevel(layers.barLeft, yPeakR, w, barHeight, g, meter.getPeakLevelR(), layers.dbScale);
 
-    // Skip drawing if width is invalid
-    if (w <= 0)
-        return;
+        drawRmsLevel(layers.barLeft, yPeakL, w, rmsHeight, g, meter.getRmsLevelL(), layers.dbScale);
+        drawRmsLevel(layers.barLeft, yPeakR, w, rmsHeight, g, meter.getRmsLevelR(), layers.dbScale);
+    }
 
-    // Calculate bar Y positions
-    const int yPeakL = juce::roundToInt(innerRect.getY());
-    const int yPeakR = yPeakL + barHeight + barSpacing;
-    const int yRmsL = yPeakL;
-    const int yRmsR = yPeakR;
+    g.drawImage(layers.overlay, bounds, juce::RectanglePlacement::stretchToFit);
+}
 
-    // Lambda to map dB values to pixel X positions
-    const auto map = [xLeft, xRight, &meter](float db) noexcept
-        {
-            return meter.positionForLevel(db, xLeft, xRight);
-        };
+/**
+ * @brief Renders the static parts of a meter once for its size and scale.
+ * @param layers  Entry to fill; its size and scale are already set.
+ * @param meter   Meter providing the dB -> pixel mapping.
+ */
+void LevelMeterLookAndFeel::buildLayers(MeterLayers& layers, const LevelMeter& meter) const
+{
+    constexpr float borderThickness = 1.0f;
+    constexpr float borderRadius = 4.0f;
+
+    const auto borderRect = juce::Rectangle<float>((float)layers.width, (float)layers.height).reduced(borderInset);
+    const auto innerRect = borderRect.reduced(barPadding);
 
-    // Draw peak levels
-    drawPeakLevel(xLeft, yPeakL, w, barHeight, g, meter.getPeakLevelL(), map);
-    drawPeakLevel(xLeft, yPeakR, w, barHeight, g, meter.getPeakLevelR(), map);
+    layers.barLeft = juce::roundToInt(innerRect.getX());
+    layers.barRight = juce::roundToInt(innerRect.getRight());
+    layers.barTop = juce::roundToInt(innerRect.getY());
 
-    // Draw RMS levels
-    drawRmsLevel(xLeft, yRmsL, w, rmsHeight, g, meter.getRmsLevelL(), map);
-    drawRmsLevel(xLeft, yRmsR, w, rmsHeight, g, meter.getRmsLevelR(), map);
+    const int xLeft = layers.barLeft;
+    const int xRight = layers.barRight;
 
-    // Draw tick marks and numeric labels
-    const int tickTop = yPeakL + 2; // offset down from top
-    constexpr int tickHeight = 14;
-    const int labelTop = tickTop + tickHeight;
-    constexpr int labelHeight = 12;
-    constexpr int labelWidth = 25;
+    layers.dbScale.prepare(LevelMeter::mindB, LevelMeter::maxdB,
+        [xLeft, xRight, &meter](float db) { return meter.positionForLevel(db, (float)xLeft, (float)xRight); });
+
+    layers.background = layers.renderLayer([&](juce::Graphics& g)
+        {
+            g.fillAll(Colors::LevelMeter::background);
+            g.setColour(Colors::LevelMeter::border);
+            g.drawRoundedRectangle(borderRect, borderRadius, borderThickness);
+        });
 
-    for (float db = meter.maxdB; db >= meter.mindB; db -= meter.stepdB)
+    if (xRight <= xLeft)
     {
-        const int x = map(db);
-        drawTickWithLabel(g, x, tickTop, tickHeight,
-            juce::String(int(db)),
-            labelTop, labelWidth, labelHeight);
+        layers.overlay = layers.renderLayer([](juce::Graphics&) {});
+        return;
     }
+
+    layers.overlay = layers.renderLayer([&](juce::Graphics& g)
+        {
+            g.setFont(Fonts::getFont(tickFontHeight));
+
+            // Draw tick marks and numeric labels
+            const int tickTop = layers.barTop + 2; // offset down from top
+            constexpr int tickHeight = 14;
+            const int labelTop = tickTop + tickHeight;
+            constexpr int labelHeight = 12;
+            constexpr int labelWidth = 25;
+
+            for (float db = LevelMeter::maxdB; db >= LevelMeter::mindB; db -= LevelMeter::stepdB)
+            {
+                const int x = layers.dbScale.positionForLevel(db);
+                drawTickWithLabel(g, x, tickTop, tickHeight,
+                    juce::String(int(db)),
+                    labelTop, labelWidth, labelHeight);
+            }
+        });
 }
 
 /**
@@ -96,14 +115,14 @@ void LevelMeterLookAndFeel::drawLevelMeter(juce::Graphics& g, const LevelMeter&
  * @param height             Height of the bar in pixels.
  * @param g                  JUCE graphics context for drawing.
  * @param levelDB            The signal level in decibels (dB).
- * @param positionForLevel   Function mapping dB values to X coordinates.
+ * @param scale              Precomputed dB -> X positions of the bar area.
  * @param fillColour         Colour to fill for levels below 0 dBFS.
  *
  * @note Levels above 0 dBFS are drawn in Colors::LevelMeter::tooLoud.
  */
 void LevelMeterLookAndFeel::drawMeterBar(int x, int y, int width, int height,
     juce::Graphics& g, float levelDB,
-    const std::function<int(float)>& positionForLevel,
+    const MeterScale& scale,
     juce::Colour fillColour) noexcept
 {
     if (!std::isfinite(levelDB) || levelDB <= clampdB || width <= 0 || height <= 0)
@@ -112,13 +131,8 @@ void LevelMeterLookAndFeel::drawMeterBar(int x, int y, int width, int height,
     jassert(x + width >= x); // geometry sanity check
 
     // Clamp pixel position to the bar's region
-    const auto clampToBar = [x, width, &positionForLevel](float db) noexcept -> int
-        {
-            return juce::jlimit(x, x + width, positionForLevel(db));
-        };
-
-    const int xStart = clampToBar(levelDB);
-    const int xZero = clampToBar(0.0f);
+    const int xStart = juce::jlimit(x, x + width, scale.positionForLevel(levelDB));
+    const int xZero = juce::jlimit(x, x + width, scale.positionForLevel(0.0f));
 
     if (xStart > xZero)
     {
@@ -146,14 +160,14 @@ void LevelMeterLookAndFeel::drawMeterBar(int x, int y, int width, int height,
  * @param height             Height of the peak meter bar.
  * @param g                  JUCE graphics context.
  * @param levelDB            Peak level in dB.
- * @param positionForLevel   Mapping function from dB to X pixel position.
+ * @param scale              Precomputed dB -> X positions of the bar area.
  */
 void LevelMeterLookAndFeel::drawPeakLevel(int x, int y, int width, int height,
     juce::Graphics& g,
     float levelDB,
-    const std::function<int(float)>& positionForLevel) noexcept
+    const MeterScale& scale) noexcept
 {
-    drawMeterBar(x, y, width, height, g, levelDB, positionForLevel,
+    drawMeterBar(x, y, width, height, g, levelDB, scale,
         Colors::LevelMeter::peakLevelOK);
 }
 
@@ -165,13 +179,13 @@ void LevelMeterLookAndFeel::drawPeakLevel(int x, int y, int width, int height,
  * @param height             Height of the RMS meter bar.
  * @param g                  JUCE graphics context.
  * @param levelDB            RMS level in dB.
- * @param positionForLevel   Mapping function from dB to X pixel position.
+ * @param scale              Precomputed dB -> X positions of the bar area.
  */
 void LevelMeterLookAndFeel::drawRmsLevel(int x, int y, int width, int height,
     juce::Graphics& g,
     float levelDB,
-    const std::function<int(float)>& positionForLevel) noexcept
+    const MeterScale& scale) noexcept
 {
-    drawMeterBar(x, y, width, height, g, levelDB, positionForLevel,
+    drawMeterBar(x, y, width, height, g, levelDB, scale,
         Colors::LevelMeter::rmsLevelOK);
 }
\ No newline at end of file
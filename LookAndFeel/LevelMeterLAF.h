@@ -35,21 +35,36 @@ public:
 
     void drawMeterBar(int x, int y, int width, int height,
         juce::Graphics& g, float levelDB,
-        const std::function<int(float)>& positionForLevel,
+        const MeterScale& scale,
         juce::Colour fillColour) noexcept;
 
     void drawPeakLevel(int x, int y, int width, int height,
         juce::Graphics& g,
         float levelDB,
-        const std::function<int(float)>& positionForLevel) noexcept;
+        const MeterScale& scale) noexcept;
 
     void drawRmsLevel(int x, int y, int width, int height,
         juce::Graphics& g,
         float levelDB,
-        const std::function<int(float)>& positionForLevel) noexcept;
+        const MeterScale& scale) noexcept;
+
+    /** Drops the cached meter layers, e.g. for benchmarking. */
+    void clearLayerCache() noexcept { layerCache.clear(); }
 
 private:
     static constexpr float clampdB = -120.0f;
 
+    // Bar layout, shared by the cached layers and the per-frame bars
+    static constexpr float borderInset = 7.0f;
+    static constexpr float barPadding = 10.0f;
+    static constexpr int barHeight = 7;
+    static constexpr int rmsHeight = 4;
+    static constexpr int barSpacing = 2;
+
+    MeterLayerCache layerCache;
+
+    /** Renders background, border, ticks and labels and fills in the dB table. */
+    void buildLayers(MeterLayers& layers, const LevelMeter& meter) const;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LevelMeterLookAndFeel)
 };
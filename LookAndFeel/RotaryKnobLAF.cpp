@@ -135,7 +135,8 @@ RotaryKnobLookAndFeel::RotaryKnobLookAndFeel()
  * @param slider            Slider reference to draw.
  * @note This method will look for a parent RotaryKnob component to query
  *       tick count and alert level. The value arc is drawn only if the slider
- *       is enabled.
+ *       is enabled. Everything except the dial indicator and value arc comes
+ *       from a cached image rendered once per size, range and scale factor.
  */
 void RotaryKnobLookAndFeel::drawRotarySlider(juce::Graphics& g, int x, int y, int width,
     [[maybe_unused]] int height, float sliderPos,
@@ -149,31 +150,27 @@ void RotaryKnobLookAndFeel::drawRotarySlider(juce::Graphics& g, int x, int y, in
     auto* knob = slider.findParentComponentOfClass<RotaryKnob>();
     const float  alertLevel = knob ? knob->getAlertLevel() : 0.0f;
     const int    numTicks = knob ? knob->getNumTicks() : 0;
-    const float  tickRadius = knobRect.getWidth() * 0.5f + 2.0f;
 
-    drawTicks(g, numTicks, knobCenter, tickRadius, rotaryStartAngle, rotaryEndAngle);
-    drawKnobBody(g, knobRect);
-
-    const auto innerRect = knobRect.reduced(2.f);
-    juce::ColourGradient gradient(
-        Colors::Knob::gradientTop, innerRect.getCentreX(), innerRect.getY(),
-        Colors::Knob::gradientBottom, innerRect.getCentreX(), innerRect.getBottom(), false);
-    g.setGradientFill(gradient);
-    g.fillEllipse(innerRect);
+    if (layerCacheEnabled && width > 0)
+    {
+        const StaticLayerKey key{ width, numTicks, rotaryStartAngle, rotaryEndAngle,
+            quantiseLayerScale(g.getInternalContext().getPhysicalPixelScaleFactor()) };
 
-    const auto bevelRect = innerRect.reduced(1.5f);
-    g.setColour(juce::Colours::white.withAlpha(0.08f));
-    g.drawEllipse(bevelRect, 1.0f);
+        g.drawImage(getStaticLayer(key), bounds, juce::RectanglePlacement::stretchToFit);
+    }
+    else
+    {
+        drawStaticLayers(g, bounds, numTicks, rotaryStartAngle, rotaryEndAngle);
+    }
 
+    const auto innerRect = knobRect.reduced(2.f);
     const juce::Point<float> boundsCenter = bounds.getCentre();
     const float radius = bounds.getWidth() * 0.5f;
-    constexpr float lineWidth = 3.0f;
     const float arcRadius = radius - lineWidth * 0.5f;
 
     const juce::PathStrokeType stroke(lineWidth,
         juce::PathStrokeType::curved,
         juce::PathStrokeType::rounded);
-    drawArcTrack(g, bounds, boundsCenter, arcRadius, rotaryStartAngle, rotaryEndAngle, stroke);
 
     const float span = (rotaryEndAngle - rotaryStartAngle);
     const float pos01 = juce::jlimit(0.0f, 1.0f, sliderPos);
@@ -186,6 +183,73 @@ void RotaryKnobLookAndFeel::drawRotarySlider(juce::Graphics& g, int x, int y, in
         drawValueArc(g, slider, boundsCenter, stroke, rotaryStartAngle, rotaryEndAngle, arcRadius, toAngle, alertLevel);
 }
 
+void RotaryKnobLookAndFeel::drawStaticLayers(juce::Graphics& g,
+    const juce::Rectangle<float>& bounds,
+    int numTicks,
+    float rotaryStartAngle,
+    float rotaryEndAngle) noexcept
+{
+    const juce::Rectangle<float> knobRect = bounds.reduced(10.f);
+    const float tickRadius = knobRect.getWidth() * 0.5f + 2.0f;
+
+    drawTicks(g, numTicks, knobRect.getCentre(), tickRadius, rotaryStartAngle, rotaryEndAngle);
+    drawKnobBody(g, knobRect);
+
+    const auto innerRect = knobRect.reduced(2.f);
+    juce::ColourGradient gradient(
+        Colors::Knob::gradientTop, innerRect.getCentreX(), innerRect.getY(),
+        Colors::Knob::gradientBottom, innerRect.getCentreX(), innerRect.getBottom(), false);
+    g.setGradientFill(gradient);
+    g.fillEllipse(innerRect);
+
+    const auto bevelRect = innerRect.reduced(1.5f);
+    g.setColour(juce::Colours::white.withAlpha(0.08f));
+    g.drawEllipse(bevelRect, 1.0f);
+
+    const float arcRadius = bounds.getWidth() * 0.5f - lineWidth * 0.5f;
+    const juce::PathStrokeType stroke(lineWidth,
+        juce::PathStrokeType::curved,
+        juce::PathStrokeType::rounded);
+    drawArcTrack(g, bounds, bounds.getCentre(), arcRadius, rotaryStartAngle, rotaryEndAngle, stroke);
+}
+
+/**
+ * @brief Looks up or renders the static layers of a knob.
+ *
+ * The image is rendered at physical resolution, so compositing it is a plain
+ * blit and stays sharp on HiDPI displays.
+ */
+const juce::Image& RotaryKnobLookAndFeel::getStaticLayer(const StaticLayerKey& key)
+{
+    return layerCache.get(key, [&]
+    {
+        const int side = juce::jmax(1, juce::roundToInt((float)key.width * key.scale));
+        juce::Image image(juce::Image::ARGB, side, side, true);
+
+        {
+            juce::Graphics ig(image);
+            ig.addTransform(juce::AffineTransform::scale((float)side / (float)key.width));
+            drawStaticLayers(ig, { (float)key.width, (float)key.width }, key.numTicks,
+                key.rotaryStartAngle, key.rotaryEndAngle);
+        }
+
+        return image;
+    });
+}
+
+void RotaryKnobLookAndFeel::setLayerCacheEnabled(bool shouldCache)
+{
+    layerCacheEnabled = shouldCache;
+
+    if (!shouldCache)
+        clearLayerCache();
+}
+
+void RotaryKnobLookAndFeel::clearLayerCache()
+{
+    layerCache.clear();
+}
+
 /**
  * @brief Draws evenly spaced tick marks around the knob.
  * @param g                 Graphics context.
@@ -82,10 +82,67 @@ public:
 
     juce::Label* createSliderTextBox(juce::Slider& slider);
 
+    /**
+     * @brief Turns the static layer cache on or off; off redraws every layer on each paint.
+     * @param shouldCache False only for benchmarking and debugging.
+     */
+    void setLayerCacheEnabled(bool shouldCache);
+
+    /** @brief Drops every cached layer image. */
+    void clearLayerCache();
+
 
 private:
+    /**
+     * @brief Identifies one rendering of the static layers.
+     *
+     * Everything that changes the ticks, body, gradient, bevel or arc track is part
+     * of the key, so knobs of the same size and range share one image.
+     */
+    struct StaticLayerKey
+    {
+        int width = 0;                  ///< Knob bounds in logical pixels (bounds are square)
+        int numTicks = 0;
+        float rotaryStartAngle = 0.0f;
+        float rotaryEndAngle = 0.0f;
+        float scale = 1.0f;             ///< Physical pixels per logical pixel
+
+        bool operator==(const StaticLayerKey& other) const noexcept
+        {
+            return width == other.width && numTicks == other.numTicks
+                && rotaryStartAngle == other.rotaryStartAngle && rotaryEndAngle == other.rotaryEndAngle
+                && scale == other.scale;
+        }
+    };
+
+    /**
+     * @brief Returns the static layers for a key, rendering them on a cache miss.
+     * @param key Size, range and scale of the knob.
+     * @return ARGB image of width * scale physical pixels square.
+     */
+    const juce::Image& getStaticLayer(const StaticLayerKey& key);
+
+    /**
+     * @brief Draws ticks, body, gradient fill, bevel and arc track.
+     * @param g                 Graphics context.
+     * @param bounds            Square knob bounds.
+     * @param numTicks          Number of ticks to draw.
+     * @param rotaryStartAngle  Start angle in radians.
+     * @param rotaryEndAngle    End angle in radians.
+     */
+    void drawStaticLayers(juce::Graphics& g,
+        const juce::Rectangle<float>& bounds,
+        int numTicks,
+        float rotaryStartAngle,
+        float rotaryEndAngle) noexcept;
+
     juce::DropShadow dropShadow{ Colors::Knob::dropShadow, 6, { 0, 3 } };
 
+    LayerCache<StaticLayerKey, juce::Image> layerCache;
+    bool layerCacheEnabled = true;
+
+    static constexpr float lineWidth = 3.0f;       ///< Arc track, value arc and dial ring
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RotaryKnobLookAndFeel)
 };
 
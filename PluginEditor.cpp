@@ -21,64 +21,186 @@ GuideLinesCompAudioProcessorEditor::GuideLinesCompAudioProcessorEditor(GuideLine
 {
     setLookAndFeel(&mainLF);
 
-    addAndMakeVisible(presetPanel);
+    // Everything is laid out once at the base size; resizing scales the whole content
+    content.setInterceptsMouseClicks(false, true);
+    addAndMakeVisible(content);
 
-    addAndMakeVisible(lowCutKnob);
+    content.addAndMakeVisible(presetPanel);
+    content.addAndMakeVisible(snapshotBar);
+
+    // The processor also restarts the integrated loudness whenever the host transport starts
+    loudnessResetButton.setTooltip("Restart integrated loudness and LRA");
+    loudnessResetButton.onClick = [this] { audioProcessor.resetLoudness(); };
+    content.addAndMakeVisible(loudnessResetButton);
+
+    content.addAndMakeVisible(lowCutKnob);
 
     // Compress group
     //compressGroup.setText("Compress");
     //compressGroup.setTextLabelPosition(juce::Justification::horizontallyCentred);
     compressGroup.addAndMakeVisible(compressionKnob);
     compressGroup.addAndMakeVisible(inputMeter);
-    addAndMakeVisible(compressGroup);
+    content.addAndMakeVisible(compressGroup);
 
     // Control group
     //controlGroup.setText("Control");
     //controlGroup.setTextLabelPosition(juce::Justification::horizontallyCentred);
     controlGroup.addAndMakeVisible(controlKnob);
     controlGroup.addAndMakeVisible(gRMeter);
-    addAndMakeVisible(controlGroup);
+    content.addAndMakeVisible(controlGroup);
 
     // Output group
     //outputGroup.setText("Output");
     //outputGroup.setTextLabelPosition(juce::Justification::horizontallyCentred);
     outputGroup.addAndMakeVisible(outputGainKnob);
     outputGroup.addAndMakeVisible(outputMeter);
-    addAndMakeVisible(outputGroup);
+    content.addAndMakeVisible(outputGroup);
+
+    content.addAndMakeVisible(gRHistory);
+
+    // Analysis column to the right of the controls
+    content.addAndMakeVisible(waveformOverview);
+    content.addAndMakeVisible(spectrumDisplay);
+    content.addAndMakeVisible(transferCurve);
 
-    setSize(400, 550);
-    startTimerHz(60);
+    updateTransferCurve();
+
+    setResizable(true, true);
+    setResizeLimits(juce::roundToInt(baseWidth * minScale), juce::roundToInt(baseHeight * minScale),
+        juce::roundToInt(baseWidth * maxScale), juce::roundToInt(baseHeight * maxScale));
+    getConstrainer()->setFixedAspectRatio((double)baseWidth / (double)baseHeight);
+
+    const float scale = juce::jlimit(minScale, maxScale, audioProcessor.getEditorScale());
+    setSize(juce::roundToInt(baseWidth * scale), juce::roundToInt(baseHeight * scale));
 }
 
 GuideLinesCompAudioProcessorEditor::~GuideLinesCompAudioProcessorEditor()
 {
+    // Only withdraw this editor's own count; another editor of the same instance may still be open
+    if (meteringShown)
+        audioProcessor.setEditorVisible(false);
+
     setLookAndFeel(nullptr);
 }
 
+void GuideLinesCompAudioProcessorEditor::visibilityChanged()
+{
+    updateMeteringVisibility();
+}
+
+void GuideLinesCompAudioProcessorEditor::parentHierarchyChanged()
+{
+    updateMeteringVisibility();
+}
+
+void GuideLinesCompAudioProcessorEditor::updateMeteringVisibility()
+{
+    const bool showing = isShowing();
+    if (showing == meteringShown)
+        return;
+
+    meteringShown = showing;
+
+    if (showing)
+    {
+        // Records queued before the editor was hidden are stale; drop them before metering resumes
+        audioProcessor.getTelemetry().discard();
+        knobInputPeak = 0.0f;
+        knobCompression = 0.0f;
+        knobOutputPeak = 0.0f;
+    }
+
+    audioProcessor.setEditorVisible(showing);
+}
+
 //==============================================================================
 void GuideLinesCompAudioProcessorEditor::paint(juce::Graphics& g)
 {
     g.fillAll(Colors::background);
 
-    auto rect = getLocalBounds().withHeight(40);
+    // The header is drawn in base coordinates like the content below it
+    g.addTransform(content.getTransform());
+
+    auto rect = juce::Rectangle<int>(baseWidth, headerStripHeight);
     g.setColour(Colors::header);
     g.fillRect(rect);
+
+    paintLoudnessReadout(g, rect.reduced(10, 0));
+    paintSafetyIndicator(g, rect.reduced(10, 0));
+}
+
+void GuideLinesCompAudioProcessorEditor::paintLoudnessReadout(juce::Graphics& g, juce::Rectangle<int> area)
+{
+    g.setColour(Colors::Group::label);
+    g.setFont(12.0f);
+    g.drawText(shownLoudness, area.withWidth(loudnessReadoutWidth), juce::Justification::centredLeft);
+}
+
+juce::String GuideLinesCompAudioProcessorEditor::formatLoudness() const
+{
+    const auto& meter = audioProcessor.getLoudnessMeter();
+
+    auto lufs = [](float value)
+    {
+        return value <= LoudnessMeter::silenceLufs ? juce::String("-inf") : juce::String(value, 1);
+    };
+
+    return "M " + lufs(meter.getMomentaryLoudness())
+        + "  S " + lufs(meter.getShortTermLoudness())
+        + "  I " + lufs(meter.getIntegratedLoudness()) + " LUFS"
+        + "  LRA " + juce::String(meter.getLoudnessRange(), 1) + " LU";
+}
+
+void GuideLinesCompAudioProcessorEditor::paintSafetyIndicator(juce::Graphics& g, juce::Rectangle<int> area)
+{
+    if (shownNonFiniteEvents == 0 && shownOverEvents == 0)
+        return;
+
+    // NaN/Inf mutes are the serious case and take the alarm colour
+    juce::String text;
+    if (shownNonFiniteEvents > 0)
+        text << "NaN/Inf muted: " << juce::String(shownNonFiniteEvents) << "  ";
+    if (shownOverEvents > 0)
+        text << "Overs: " << juce::String(shownOverEvents);
+
+    g.setColour(shownNonFiniteEvents > 0 ? Colors::LevelMeter::tooLoud : Colors::Group::label);
+    g.setFont(12.0f);
+    g.drawText(text.trim(), area, juce::Justification::centredRight);
 }
 
 void GuideLinesCompAudioProcessorEditor::resized()
 {
-    auto bounds = getLocalBounds();
+    // Scaling the content as a whole keeps the layout proportional; cached layers are keyed
+    // by the physical scale, so they are re-rendered once per zoom step rather than per frame.
+    const float scale = (float)getWidth() / (float)baseWidth;
+    content.setBounds(0, 0, baseWidth, baseHeight);
+    content.setTransform(juce::AffineTransform::scale(scale));
+    audioProcessor.setEditorScale(scale);
+
+    layoutContent();
+
+    // The history keeps a physical-resolution image of its own; it does not see the zoom change
+    gRHistory.updatePhysicalScale();
+}
+
+void GuideLinesCompAudioProcessorEditor::layoutContent()
+{
+    const auto bounds = content.getLocalBounds();
 
     int headerHeight = 50;
     int knobWidth = 57;
     int padding = 7;
     int y = headerHeight + padding;
 
-    int groupWidth = bounds.getWidth() - 3 * padding;
+    int groupWidth = mainColumnWidth - 3 * padding;
     int groupHeight = 105;
     int meterWidth = groupWidth - knobWidth - (3 * padding);
     int meterHeight = 55;
 
+    const int resetButtonHeight = 20;
+    loudnessResetButton.setBounds(10 + loudnessReadoutWidth, (headerStripHeight - resetButtonHeight) / 2,
+        48, resetButtonHeight);
+
     lowCutKnob.setTopLeftPosition(padding * 2, y + padding);
 
     presetPanel.setBounds(lowCutKnob.getRight() + (padding * 4), lowCutKnob.getY() + (padding * 2), groupWidth - (lowCutKnob.getWidth() + (padding * 4)), groupHeight / 2.5);
@@ -98,17 +220,104 @@ void GuideLinesCompAudioProcessorEditor::resized()
     auto outputArea = outputGroup.getLocalBounds().reduced(padding);
     outputGainKnob.setTopLeftPosition(outputArea.getX(), outputArea.getY());
     outputMeter.setBounds(outputGainKnob.getRight() + padding, outputGainKnob.getY() + 2 * padding, meterWidth, meterHeight);
+
+    gRHistory.setBounds(padding, outputGroup.getBottom() + padding, groupWidth,
+        bounds.getBottom() - outputGroup.getBottom() - 2 * padding);
+
+    const int analysisX = compressGroup.getRight() + padding;
+    const int analysisWidth = bounds.getRight() - analysisX - padding;
+
+    snapshotBar.setBounds(analysisX, presetPanel.getY(), analysisWidth, presetPanel.getHeight());
+    waveformOverview.setBounds(analysisX, compressGroup.getY(), analysisWidth, groupHeight);
+    spectrumDisplay.setBounds(analysisX, controlGroup.getY(), analysisWidth, groupHeight);
+    transferCurve.setBounds(analysisX, outputGroup.getY(), analysisWidth,
+        bounds.getBottom() - outputGroup.getY() - padding);
+}
+
+
+juce::Rectangle<int> GuideLinesCompAudioProcessorEditor::getHeaderArea() const
+{
+    return juce::Rectangle<int>(baseWidth, headerStripHeight).transformedBy(content.getTransform()).expanded(1);
 }
 
+void GuideLinesCompAudioProcessorEditor::drainTelemetry()
+{
+    float inputPeak = 0.0f;
+    float compression = 0.0f;
+    float outputPeak = 0.0f;
+    float lowCut = 0.0f;
+    float inputRms = 0.0f;
+
+    const double sampleRate = audioProcessor.getSampleRate();
+    const double secondsPerSample = sampleRate > 0.0 ? 1.0 / sampleRate : 0.0;
+
+    // Every block since the last frame reaches the meters, so short peaks are never skipped
+    const int numRecords = audioProcessor.getTelemetry().drain([&](const TelemetryRecord& record)
+    {
+        inputMeter.pushLevels(record.inputPeak.left, record.inputPeak.right,
+            record.inputRms.left, record.inputRms.right);
+        outputMeter.pushLevels(record.outputPeak.left, record.outputPeak.right,
+            record.outputRms.left, record.outputRms.right);
+        gRMeter.pushGainReduction(record.gainReduction.left, record.gainReduction.right);
+        gRHistory.pushBlock(juce::jmin(record.gainReduction.left, record.gainReduction.right),
+            record.numSamples * secondsPerSample);
+
+        inputPeak = juce::jmax(inputPeak, record.inputPeak.getMax());
+        compression = juce::jmax(compression, record.compAGainReductionDb, record.compBGainReductionDb);
+        outputPeak = juce::jmax(outputPeak, record.outputPeak.getMax());
+        lowCut = record.lowCutHz;
+        inputRms = record.inputRms.getMax();
+    });
+
+    if (numRecords == 0)
+        return;
+
+    knobInputPeak = inputPeak;
+    knobCompression = compression;
+    knobOutputPeak = outputPeak;
+    spectrumDisplay.setLowCutFrequency(lowCut);
+    transferCurve.setInputLevel(inputRms);
+}
 
-void GuideLinesCompAudioProcessorEditor::timerCallback()
+void GuideLinesCompAudioProcessorEditor::updateTransferCurve()
 {
-    auto input = audioProcessor.getPeakInputLevelForKnob();
-    auto compress = audioProcessor.getCompressionAmountForKnob();
-    auto output = audioProcessor.getPeakOutputLevelForKnob();
+    // Raw values are cheap to poll; the curve itself only rebuilds when one of them changed
+    auto& apvts = audioProcessor.apvts;
+    transferCurve.setParameters(apvts.getRawParameterValue(compressionParamID.getParamID())->load(),
+        apvts.getRawParameterValue(controlParamID.getParamID())->load(),
+        apvts.getRawParameterValue(outputGainParamID.getParamID())->load());
+}
+
+void GuideLinesCompAudioProcessorEditor::refreshFrame(double elapsedSeconds)
+{
+    updateTransferCurve();
+    drainTelemetry();
+
+    // Each display repaints only if what it shows actually changed
+    inputMeter.refresh(elapsedSeconds);
+    outputMeter.refresh(elapsedSeconds);
+    gRMeter.refresh(elapsedSeconds);
+    waveformOverview.refresh();
+    spectrumDisplay.refresh();
+    presetPanel.refresh();
+
+    compressionKnob.setAlertLevel(getNormalizedAlertLevel(knobInputPeak, 0.8f, 1.2f));
+    controlKnob.setAlertLevel(juce::jlimit(0.f, 1.f, knobCompression / 12));
+    outputGainKnob.setAlertLevel(getNormalizedAlertLevel(knobOutputPeak, 0.8f, 1.2f));
+
+    const auto& safety = audioProcessor.getOutputSafety();
+    const auto nonFinite = safety.getNonFiniteEvents();
+    const auto overs = safety.getOverEvents();
+
+    // The loudness values change at most every 100 ms, so only repaint when the text differs
+    auto loudness = formatLoudness();
 
-    compressionKnob.setAlertLevel(getNormalizedAlertLevel(input, 0.8f, 1.2f));
-    controlKnob.setAlertLevel(juce::jlimit(0.f, 1.f, compress / 12));
-    outputGainKnob.setAlertLevel(getNormalizedAlertLevel(output, 0.8f, 1.2f));
+    if (nonFinite != shownNonFiniteEvents || overs != shownOverEvents || loudness != shownLoudness)
+    {
+        shownNonFiniteEvents = nonFinite;
+        shownOverEvents = overs;
+        shownLoudness = std::move(loudness);
+        repaint(getHeaderArea());
+    }
 
 }
\ No newline at end of file
@@ -15,12 +15,18 @@
 #include "GUI/AsymmetricalRotaryKnob.h"
 #include "GUI/LevelMeter.h"
 #include "GUI/GainReductionMeter.h"
+#include "GUI/GainReductionHistory.h"
+#include "GUI/WaveformOverview.h"
+#include "GUI/SpectrumDisplay.h"
+#include "GUI/TransferCurve.h"
 #include "GUI/PresetPanel.h"
+#include "GUI/SnapshotBar.h"
+#include "GUI/RefreshScheduler.h"
 
 //==============================================================================
 /**
 */
-class GuideLinesCompAudioProcessorEditor : public juce::AudioProcessorEditor, private juce::Timer
+class GuideLinesCompAudioProcessorEditor : public juce::AudioProcessorEditor
 {
 public:
     GuideLinesCompAudioProcessorEditor(GuideLinesCompAudioProcessor&);
@@ -29,34 +35,76 @@ public:
     //==============================================================================
     void paint(juce::Graphics&) override;
     void resized() override;
-    void timerCallback() override;
+    void visibilityChanged() override;
+    void parentHierarchyChanged() override;
+
+    /**
+        Drains the processor's telemetry and refreshes every display, once per frame.
+        Called by the refresh scheduler; offscreen benchmarks call it to stand in for the display.
+        @param elapsedSeconds Time since the previous frame.
+    */
+    void refreshFrame(double elapsedSeconds);
 
 private:
 
     MainLookAndFeel mainLF;
     GuideLinesCompAudioProcessor& audioProcessor;
 
+    juce::Component content;                  ///< Holds every control at base size, scaled as a whole
+
     RotaryKnob lowCutKnob{ "Lo Cut", audioProcessor.apvts, lowCutParamID };
     RotaryKnob compressionKnob{ "Compress", audioProcessor.apvts, compressionParamID }; // Strength
     RotaryKnob controlKnob{ "Control", audioProcessor.apvts, controlParamID }; // Color
     AsymmetricalRotaryKnob outputGainKnob{ "Out", audioProcessor.apvts, outputGainParamID };
 
-    LevelMeter inputMeter{
-        audioProcessor.peakInputLevelLeft, audioProcessor.peakInputLevelRight,
-        audioProcessor.rmsInputLevelLeft, audioProcessor.rmsInputLevelRight };
-
-    LevelMeter outputMeter{
-        audioProcessor.peakOutputLevelLeft, audioProcessor.peakOutputLevelRight,
-        audioProcessor.rmsOutputLevelLeft, audioProcessor.rmsOutputLevelRight };
-
-    GainReductionMeter gRMeter{
-        audioProcessor.rmsTotalGainReductionLeft, audioProcessor.rmsTotalGainReductionRight };
+    LevelMeter inputMeter;
+    LevelMeter outputMeter;
+    GainReductionMeter gRMeter;
+    GainReductionHistory gRHistory;
+    WaveformOverview waveformOverview{ audioProcessor.getWaveformPyramid() };
+    SpectrumDisplay spectrumDisplay{ audioProcessor.getSpectrumAnalyzer() };
+    TransferCurve transferCurve;
 
     juce::GroupComponent compressGroup;
     juce::GroupComponent controlGroup;
     juce::GroupComponent outputGroup;
 
     Gui::PresetPanel presetPanel;
+    Gui::SnapshotBar snapshotBar{ audioProcessor.getSnapshotBank() };
+    juce::TextButton loudnessResetButton{ "Reset" };   ///< Restarts integrated loudness and LRA
+
+    std::uint32_t shownNonFiniteEvents = 0;   ///< Safety counters at the last header repaint
+    std::uint32_t shownOverEvents = 0;
+
+    juce::String shownLoudness;               ///< Loudness readout at the last header repaint
+
+    static constexpr int mainColumnWidth = 400;       ///< Knobs, meters and presets
+    static constexpr int analysisColumnWidth = 300;   ///< Waveform and analysis views
+    static constexpr int baseWidth = mainColumnWidth + analysisColumnWidth;
+    static constexpr int baseHeight = 610;
+    static constexpr int headerStripHeight = 40;      ///< Painted header strip, in base coordinates
+    static constexpr int loudnessReadoutWidth = 270;  ///< Room for the loudness text left of its reset button
+    static constexpr float minScale = 0.75f;          ///< Resize limits relative to the base size
+    static constexpr float maxScale = 2.0f;
+
+    float knobInputPeak = 0.0f;               ///< Knob alert sources, held when no block arrived
+    float knobCompression = 0.0f;
+    float knobOutputPeak = 0.0f;
+
+    bool meteringShown = false;               ///< Last visibility reported to the processor
+
+    void drainTelemetry();
+    void updateMeteringVisibility();
+    void updateTransferCurve();
+    void layoutContent();
+    juce::Rectangle<int> getHeaderArea() const;
+
+    void paintSafetyIndicator(juce::Graphics& g, juce::Rectangle<int> area);
+    void paintLoudnessReadout(juce::Graphics& g, juce::Rectangle<int> area);
+    juce::String formatLoudness() const;
+
+    /// Single frame clock for every display; declared last so it stops before anything it refreshes goes away.
+    RefreshScheduler refreshScheduler{ *this, [this](double elapsedSeconds) { refreshFrame(elapsedSeconds); } };
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(GuideLinesCompAudioProcessorEditor)
 };
\ No newline at end of file
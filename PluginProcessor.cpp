@@ -18,15 +18,20 @@ GuideLinesCompAudioProcessor::GuideLinesCompAudioProcessor() : AudioProcessor(
 ),
 params(apvts)
 {
-    lowCutFilter.setType(juce::dsp::StateVariableTPTFilterType::highpass);
     apvts.state.setProperty(Service::PresetManager::presetNameProperty, "", nullptr);
-    apvts.state.setProperty("version", ProjectInfo::versionString, nullptr);
+    apvts.state.setProperty(Service::PresetFile::versionProperty, ProjectInfo::versionString, nullptr);
 
     presetManager = std::make_unique<Service::PresetManager>(apvts);
+
+    // Linear phase changes the latency, so it is switched where the host can be told
+    apvts.addParameterListener(lowCutLinearPhaseParamID.getParamID(), this);
 }
 
 GuideLinesCompAudioProcessor::~GuideLinesCompAudioProcessor()
 {
+    apvts.removeParameterListener(lowCutLinearPhaseParamID.getParamID(), this);
+    cancelPendingUpdate();
+    backgroundThread.stopThread(1000);
 }
 
 //==============================================================================
@@ -97,23 +102,58 @@ void GuideLinesCompAudioProcessor::prepareToPlay(double sampleRate, int samplesP
     params.prepareToPlay(sampleRate);
     params.reset();
 
+    // Every stage carves its scratch buffers from one arena sized for the prepared block
+    maxChunkSize = juce::jmax(1, samplesPerBlock);
+    scratchArena.prepare(FrameBuffer::getRequiredBytes(maxChunkSize)
+        + LowCutStage::getRequiredScratchBytes());
+
     juce::dsp::ProcessSpec spec;
     spec.sampleRate = sampleRate;
-    spec.maximumBlockSize = juce::uint32(samplesPerBlock);
+    spec.maximumBlockSize = juce::uint32(maxChunkSize);
     spec.numChannels = 2;
 
-    peakOutputLevelLeft.prepare(sampleRate, 0.05);
-    peakOutputLevelRight.prepare(sampleRate, 0.05);
+    linearPhaseEngaged.store(params.lowCutLinearPhase, std::memory_order_release);
+    lowCut.setCutoffFrequency(params.lowCut);
+    lowCut.setLinearPhase(params.lowCutLinearPhase);
+    lowCut.prepare(spec, backgroundThread, scratchArena);
+
+    if (!backgroundThread.isThreadRunning())
+        backgroundThread.startThread(juce::Thread::Priority::low);
 
-    lowCutFilter.prepare(spec);
-    lowCutFilter.reset();
     compA.prepare(spec);
     compA.reset();
 
     compB.prepare(spec);
     compB.reset();
 
+    outputLimiter.setEngaged(params.limiter);
+    outputLimiter.prepare(spec);
+    loudnessMeter.prepare(spec, backgroundThread);
+    waveformPyramid.prepare(sampleRate, maxChunkSize, backgroundThread);
+    spectrumAnalyzer.prepare(sampleRate, backgroundThread);
+
+    detectorDecimationFactor = CompressorUnit::decimationFactorForSampleRate(sampleRate);
+    lastDetectorDecimation = !params.detectorDecimation;
+    updateDetectorDecimation();
+
+    // Stereo runs as interleaved L/R frames; mono stays on the planar chain
+    const int numMainChannels = getMainBusNumOutputChannels();
+    useFrameChain = numMainChannels >= 2 && numMainChannels <= (int)FrameBuffer::maxChannels;
+
+    // The planar chain is specialised for mono and stereo; other layouts take the generic one
+    switch (numMainChannels)
+    {
+        case 1:  planarChain = &GuideLinesCompAudioProcessor::processPlanarChain<1>; break;
+        case 2:  planarChain = &GuideLinesCompAudioProcessor::processPlanarChain<2>; break;
+        default: planarChain = &GuideLinesCompAudioProcessor::processPlanarChain<0>; break;
+    }
+
+    frameBuffer.prepare(scratchArena, maxChunkSize);
+
     lastLowCut = -1.f;
+
+    // The limiter delays the same when disengaged; the low cut only delays in linear phase
+    setLatencySamples(getChainLatency(params.lowCutLinearPhase));
 }
 
 void GuideLinesCompAudioProcessor::releaseResources()
@@ -142,17 +182,51 @@ bool GuideLinesCompAudioProcessor::isBusesLayoutSupported(const BusesLayout& lay
 #endif
 
 void GuideLinesCompAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    const int numSamples = buffer.getNumSamples();
+
+    // Some hosts call processBlock before prepareToPlay; nothing is allocated yet, so output silence
+    if (maxChunkSize == 0)
+    {
+        buffer.clear();
+        return;
+    }
+
+    updateLoudnessReset();
+
+    if (numSamples <= maxChunkSize)
+    {
+        processChunk(buffer);
+        return;
+    }
+
+    // Some hosts exceed the announced block size, e.g. during offline bounces. Split such blocks
+    // into pieces the prepared stages can hold; the chunks only refer to the host's channel data.
+    for (int start = 0; start < numSamples; start += maxChunkSize)
+    {
+        juce::AudioBuffer<float> chunk(buffer.getArrayOfWritePointers(), buffer.getNumChannels(),
+            start, juce::jmin(maxChunkSize, numSamples - start));
+        processChunk(chunk);
+    }
+}
+
+void GuideLinesCompAudioProcessor::processChunk(juce::AudioBuffer<float>& buffer)
 {
     initializeProcessing(buffer);
     updateBypassState();
 
     params.update();
+
+    // A recalled or morphed snapshot moves every target at once, even before its parameter writes land
+    if (const auto* snapshotTargets = snapshotBank.getHeldTargets())
+        params.setTargets(*snapshotTargets);
+
     params.smoothen();
     updateLowCutFilter();
+    updateLimiter();
+    updateDetectorDecimation();
     updateMappedCompressorParameters();
-
-    peakOutputLevelLeft.reset();
-    peakOutputLevelRight.reset();
+    updateMeteringState();
 
     // Route input/output
     juce::AudioBuffer<float> mainInput = getBusBuffer(buffer, true, 0);
@@ -169,87 +243,168 @@ void GuideLinesCompAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer
         mainOutput.copyFrom(ch, 0, mainInput, ch, 0, numSamples);
 
     juce::dsp::AudioBlock<float> block(mainOutput);
+
+    // The chain works in place, so the input side of the overview is taken now
+    if (meteringActive)
+        waveformPyramid.pushInput(mainOutput);
+
+    // Taken from the input bus, so a mono input is duplicated like the post tap rather than paired with silence
+    spectrumAnalyzer.push(SpectrumAnalyzer::pre, mainInput);
+
+    // A mono input on a stereo bus runs the chain once on the left channel and is duplicated at the end
+    if (isDualMono(mainOutput, numInputChannels))
+    {
+        juce::AudioBuffer<float> leftOnly(mainOutput.getArrayOfWritePointers(), 1, numSamples);
+        processPlanarChain<1>(leftOnly);
+        mainOutput.copyFrom(1, 0, mainOutput, 0, 0, numSamples);
+    }
+    else if (useFrameChain && lowCut.canProcessFrames()
+        && frameBuffer.canHold(block.getNumChannels(), block.getNumSamples()))
+        processFrameChain(mainOutput);
+    else
+        (this->*planarChain)(mainOutput);
+
+    // Containment runs in every build: a non-finite sample mutes the block and restarts the stages
+    const bool muted = outputSafety.process(buffer);
+    if (muted)
+        resetProcessingState();
+
+    // Published last, so the record describes the block as it leaves the plugin
+    if (meteringActive)
+    {
+        if (muted)
+        {
+            telemetry.outputPeak = {};
+            telemetry.outputRms = {};
+        }
+
+        telemetry.numSamples = numSamples;
+        telemetry.lowCutHz = params.lowCut;
+        publishTelemetry();
+    }
+
+    // Loudness is measured on what actually leaves the plugin
+    loudnessMeter.process(mainOutput);
+
+    if (meteringActive)
+        waveformPyramid.pushOutput(mainOutput);
+
+    spectrumAnalyzer.push(SpectrumAnalyzer::post, mainOutput);
+}
+
+bool GuideLinesCompAudioProcessor::isDualMono(const juce::AudioBuffer<float>& mainOutput, int numInputChannels) const noexcept
+{
+    // Only the bus layout decides: identical stereo samples may still differ in the stages' history,
+    // and the layout cannot change without another prepareToPlay
+    return numInputChannels == 1 && mainOutput.getNumChannels() == 2;
+}
+
+void GuideLinesCompAudioProcessor::resetProcessingState() noexcept
+{
+    lowCut.reset();
+    compA.reset();
+    compB.reset();
+    outputLimiter.reset();
+}
+
+template <size_t NumChannels>
+void GuideLinesCompAudioProcessor::processPlanarChain(juce::AudioBuffer<float>& mainOutput)
+{
+    juce::dsp::AudioBlock<float> block(mainOutput);
     juce::dsp::ProcessContextReplacing<float> ctx(block);
 
     mainOutput.applyGain(compressInputGainSmoother.getNextValue());
 
-    peakInputLevelForKnob.store(juce::jmax(peakInputLevelLeft.getPeak(), peakInputLevelRight.getPeak()));
-
     // --- Measure & compute input RMS + peak BEFORE processing
-    updateRMSLevels(mainOutput, rmsInputLevelLeft, rmsInputLevelRight);
-    updatePeakLevels(mainOutput, peakInputLevelLeft, peakInputLevelRight);
-    rmsInputLevelLeft.computeRMS();
-    rmsInputLevelRight.computeRMS();
+    if (meteringActive)
+    {
+        updateRMSLevels<NumChannels>(mainOutput, telemetry.inputRms);
+        updatePeakLevels<NumChannels>(mainOutput, telemetry.inputPeak);
+    }
+
+    lowCut.process<NumChannels>(ctx);
 
-    lowCutFilter.process(ctx);
-    compA.processCompression(ctx);
+    compA.processCompression<NumChannels>(ctx);
 
     // --- Measure & compute interstage RMS
-    updateRMSLevels(mainOutput, rmsCompAOutputLeft, rmsCompAOutputRight);
-    rmsCompAOutputLeft.computeRMS();
-    rmsCompAOutputRight.computeRMS();
+    if (meteringActive)
+        updateRMSLevels<NumChannels>(mainOutput, telemetry.compAOutputRms);
+
+    compB.processCompression<NumChannels>(ctx);
 
-    compB.processCompression(ctx);
-    updateRMSLevels(mainOutput, rmsCompBOutputLeft, rmsCompBOutputRight);
-    rmsCompBOutputLeft.computeRMS();
-    rmsCompBOutputRight.computeRMS();
+    if (meteringActive)
+        updateRMSLevels<NumChannels>(mainOutput, telemetry.compBOutputRms);
 
     outputGainProcessor.setGainLinear(params.outputGain);
     outputGainProcessor.process(ctx);
 
+    // Disengaged, the limiter still delays by its lookahead so the latency stays the same
+    outputLimiter.process(ctx);
+
     // --- Measure & compute output RMS + peak AFTER all processing
-    updateRMSLevels(mainOutput, rmsOutputLevelLeft, rmsOutputLevelRight);
-    updatePeakLevels(mainOutput, peakOutputLevelLeft, peakOutputLevelRight);
-    rmsOutputLevelLeft.computeRMS();
-    rmsOutputLevelRight.computeRMS();
-
-    // --- Compute gain reduction using the stored values
-    const float rmsInputL = rmsInputLevelLeft.getValue();
-    const float rmsInputR = rmsInputLevelRight.getValue();
-    const float rmsCompAOutL = rmsCompAOutputLeft.getValue();
-    const float rmsCompAOutR = rmsCompAOutputRight.getValue();
-    const float rmsCompBOutL = rmsCompBOutputLeft.getValue();
-    const float rmsCompBOutR = rmsCompBOutputRight.getValue();
-
-    float totalGR_L = juce::Decibels::gainToDecibels(rmsInputL) - juce::Decibels::gainToDecibels(rmsCompBOutL);
-    float totalGR_R = juce::Decibels::gainToDecibels(rmsInputR) - juce::Decibels::gainToDecibels(rmsCompBOutR);
-    
-    float grL = 1.0f;
-    if (rmsInputL > 0.0f && rmsCompBOutL > 0.0f)
-        grL = rmsCompBOutL / rmsInputL;
-
-    float grR = 1.0f;
-    if (rmsInputR > 0.0f && rmsCompBOutR > 0.0f)
-        grR = rmsCompBOutR / rmsInputR;
-
-    rmsTotalGainReductionLeft.update(grL);
-    rmsTotalGainReductionRight.update(grR);
-
-    rmsTotalGainReductionLeft.computeRMS();
-    rmsTotalGainReductionRight.computeRMS();
-
-    float rmsGainReductionDbL = juce::Decibels::gainToDecibels(rmsTotalGainReductionLeft.getValue());
-    float rmsGainReductionDbR = juce::Decibels::gainToDecibels(rmsTotalGainReductionRight.getValue());
-
-    compAGainReductionDbLeft.store(
-        juce::Decibels::gainToDecibels(rmsInputL) - juce::Decibels::gainToDecibels(rmsCompAOutL));
-    compAGainReductionDbRight.store(
-        juce::Decibels::gainToDecibels(rmsInputR) - juce::Decibels::gainToDecibels(rmsCompAOutR));
-
-    compBGainReductionDbLeft.store(
-        juce::Decibels::gainToDecibels(rmsCompAOutL) - juce::Decibels::gainToDecibels(rmsCompBOutL));
-    compBGainReductionDbRight.store(
-        juce::Decibels::gainToDecibels(rmsCompAOutR) - juce::Decibels::gainToDecibels(rmsCompBOutR));
-
-    float compAMax = juce::jmax(compAGainReductionDbLeft.load(), compAGainReductionDbRight.load());
-    float compBMax = juce::jmax(compBGainReductionDbLeft.load(), compBGainReductionDbRight.load());
-
-    compressionAmountForKnob.store(juce::jmax(compAMax, compBMax));
-    peakOutputLevelForKnob.store(juce::jmax(peakOutputLevelLeft.getPeak(), peakOutputLevelRight.getPeak()));
-
-#if JUCE_DEBUG
-    protectYourEars(buffer);
-#endif
+    if (meteringActive)
+    {
+        updateRMSLevels<NumChannels>(mainOutput, telemetry.outputRms);
+        updatePeakLevels<NumChannels>(mainOutput, telemetry.outputPeak);
+    }
+}
+
+void GuideLinesCompAudioProcessor::processFrameChain(juce::AudioBuffer<float>& mainOutput)
+{
+    juce::dsp::AudioBlock<float> block(mainOutput);
+
+    // Pack once, run every stage on whole L/R frames, unpack once
+    frameBuffer.pack(block, compressInputGainSmoother.getNextValue());
+
+    FrameRegister* frames = frameBuffer.getFrames();
+    const size_t numFrames = frameBuffer.getNumFrames();
+    const size_t numChannels = frameBuffer.getNumChannels();
+
+    // --- Measure & compute input RMS + peak BEFORE processing
+    if (meteringActive)
+    {
+        FrameLevels inputLevels;
+        inputLevels.measure(frames, numFrames, true);
+        publishFrameLevels(inputLevels, numFrames, telemetry.inputRms);
+        publishFramePeaks(inputLevels, telemetry.inputPeak);
+    }
+
+    lowCut.processFrames(frames, numFrames);
+    compA.processFrames(frames, numFrames, numChannels);
+
+    // --- Measure & compute interstage RMS
+    if (meteringActive)
+    {
+        FrameLevels compALevels;
+        compALevels.measure(frames, numFrames, false);
+        publishFrameLevels(compALevels, numFrames, telemetry.compAOutputRms);
+    }
+
+    compB.processFrames(frames, numFrames, numChannels);
+
+    if (meteringActive)
+    {
+        FrameLevels compBLevels;
+        compBLevels.measure(frames, numFrames, false);
+        publishFrameLevels(compBLevels, numFrames, telemetry.compBOutputRms);
+    }
+
+    const auto outputGain = FrameRegister::expand(params.outputGain);
+    for (size_t i = 0; i < numFrames; ++i)
+        frames[i] = frames[i] * outputGain;
+
+    frameBuffer.unpack(block);
+
+    // The limiter is planar; it always runs for its delay, so the output is measured after it
+    juce::dsp::ProcessContextReplacing<float> ctx(block);
+    outputLimiter.process(ctx);
+
+    // --- Measure & compute output RMS + peak AFTER all processing
+    if (meteringActive)
+    {
+        updateRMSLevels<0>(mainOutput, telemetry.outputRms);
+        updatePeakLevels<0>(mainOutput, telemetry.outputPeak);
+    }
 }
 
 //==============================================================================
@@ -266,8 +421,12 @@ juce::AudioProcessorEditor* GuideLinesCompAudioProcessor::createEditor()
 //==============================================================================
 void GuideLinesCompAudioProcessor::getStateInformation(juce::MemoryBlock& destData)
 {
+    // The editor size belongs to the session rather than to presets, so only the host's copy carries it
+    auto state = apvts.copyState();
+    state.setProperty(editorScaleProperty, getEditorScale(), nullptr);
+
     juce::MemoryOutputStream mos(destData, true);
-    apvts.state.writeToStream(mos);
+    state.writeToStream(mos);
 }
 
 void GuideLinesCompAudioProcessor::setStateInformation(const void* data, int sizeInBytes)
@@ -275,6 +434,9 @@ void GuideLinesCompAudioProcessor::setStateInformation(const void* data, int siz
     auto tree = juce::ValueTree::readFromData(data, sizeInBytes);
     if (tree.isValid())
     {
+        setEditorScale((float)tree.getProperty(editorScaleProperty, 1.0f));
+        tree.removeProperty(editorScaleProperty, nullptr);
+        Service::PresetFile::migrate(tree);
         apvts.replaceState(tree);
     }
 }
@@ -318,45 +480,80 @@ void GuideLinesCompAudioProcessor::updateLowCutFilter()
 {
     if (params.lowCut != lastLowCut)
     {
-        lowCutFilter.setCutoffFrequency(params.lowCut);
+        lowCut.setCutoffFrequency(params.lowCut);
         lastLowCut = params.lowCut;
     }
+
+    // Taken from the message thread, which has already reported the new latency; the stage fades the change
+    lowCut.setLinearPhase(linearPhaseEngaged.load(std::memory_order_acquire));
 }
 
-void GuideLinesCompAudioProcessor::updateMappedCompressorParameters()
+void GuideLinesCompAudioProcessor::updateLimiter()
 {
-    //--- Raw parameter inputs ---
-    float controlValue = juce::jlimit(1.0f, 100.0f, params.control);
-    float compressValue = juce::jlimit(1.0f, 100.0f, params.compression);
+    // Fades the limiting gain in or out; the delay and so the latency stay the same
+    outputLimiter.setEngaged(params.limiter);
+}
 
-    //--- Normalized values ---
-    float normCompress = compressValue / 100.0f;
-    float normControl = controlValue / 100.0f;
+int GuideLinesCompAudioProcessor::getChainLatency(bool linearPhase) const noexcept
+{
+    return lowCut.getLatencySamples(linearPhase) + outputLimiter.getLatencySamples();
+}
 
-    //--- Input gain (from compression value) ---
-    float inputGainDb = juce::jmap(normCompress, -3.0f, 12.0f);
-    float inputGainLin = juce::Decibels::decibelsToGain(inputGainDb);
-    compressInputGainSmoother.setTargetValue(inputGainLin);
+void GuideLinesCompAudioProcessor::updateLinearPhase()
+{
+    JUCE_ASSERT_MESSAGE_THREAD
 
-    //--- Compressor envelope shaping (from control value) ---
-    float mappedAttack = juce::mapToLog10(normControl, 60.0f, 1.0f);
-    float mappedRelease = juce::jmap(controlValue, 0.0f, 100.0f, 55.0f, 100.0f);
-    float mappedThreshold = juce::jmap(controlValue, 0.0f, 100.0f, -12.0f, -24.0f);
+    const bool engage = apvts.getRawParameterValue(lowCutLinearPhaseParamID.getParamID())->load() >= 0.5f;
+    if (engage == linearPhaseEngaged.load(std::memory_order_acquire))
+        return;
 
-    //--- Ratio scaling (from compression value) ---
-    float mappedRatio = juce::jmap(compressValue, 0.0f, 100.0f, 2.0f, 10.0f);
+    setLatencySamples(getChainLatency(engage));
+    linearPhaseEngaged.store(engage, std::memory_order_release);
+}
+
+void GuideLinesCompAudioProcessor::parameterChanged(const juce::String&, float)
+{
+    // May arrive on any thread, e.g. the audio thread for host automation
+    triggerAsyncUpdate();
+}
+
+void GuideLinesCompAudioProcessor::handleAsyncUpdate()
+{
+    updateLinearPhase();
+}
+
+void GuideLinesCompAudioProcessor::updateDetectorDecimation()
+{
+    if (params.detectorDecimation == lastDetectorDecimation)
+        return;
+
+    const int factor = params.detectorDecimation ? detectorDecimationFactor : 1;
+
+    // The opto stage detects once per block already, so only the VCA stage is decimated
+    compA.setDecimationFactor(factor);
+
+    lastDetectorDecimation = params.detectorDecimation;
+}
+
+void GuideLinesCompAudioProcessor::updateMappedCompressorParameters()
+{
+    //--- Knobs to stage settings (shared with the transfer curve display) ---
+    const auto mapping = CompressorMapping::fromControls(params.compression, params.control);
+
+    //--- Input gain (from compression value) ---
+    compressInputGainSmoother.setTargetValue(juce::Decibels::decibelsToGain(mapping.inputGainDb));
 
     //--- Apply smoothed values ---
-    controlAttackASmoother.setTargetValue(mappedAttack);
-    controlReleaseASmoother.setTargetValue(mappedRelease);
-    controlThresholdASmoother.setTargetValue(mappedThreshold);
-    compressRatioASmoother.setTargetValue(mappedRatio);
+    controlAttackASmoother.setTargetValue(mapping.attackMs);
+    controlReleaseASmoother.setTargetValue(mapping.releaseMs);
+    controlThresholdASmoother.setTargetValue(mapping.thresholdDb);
+    compressRatioASmoother.setTargetValue(mapping.ratio);
 
     //--- Update visible state ---
-    controlAttackA = mappedAttack;
-    controlReleaseA = mappedRelease;
-    compressThresholdA = mappedThreshold;
-    compressRatioA = mappedRatio;
+    controlAttackA = mapping.attackMs;
+    controlReleaseA = mapping.releaseMs;
+    compressThresholdA = mapping.thresholdDb;
+    compressRatioA = mapping.ratio;
 
     //--- Input to compressor ---
     compA.updateCompressorSettings(
@@ -366,50 +563,129 @@ void GuideLinesCompAudioProcessor::updateMappedCompressorParameters()
         controlThresholdASmoother.getNextValue());
 }
 
+void GuideLinesCompAudioProcessor::updateMeteringState() noexcept
+{
+    const bool visible = visibleEditors.load(std::memory_order_acquire) > 0;
+
+    // Nothing was measured while hidden, so start from silence rather than the last shown levels
+    if (visible && !meteringActive)
+    {
+        telemetry = {};
+        waveformPyramid.reset();
+    }
+
+    meteringActive = visible;
+}
+
+void GuideLinesCompAudioProcessor::updateLoudnessReset() noexcept
+{
+    bool isPlaying = false;
+
+    if (auto* playHead = getPlayHead())
+        if (const auto position = playHead->getPosition())
+            isPlaying = position->getIsPlaying();
+
+    // Integrated loudness and LRA describe one pass through the material, so each playback starts over
+    const bool transportStarted = isPlaying && !wasPlaying;
+    wasPlaying = isPlaying;
+
+    if (loudnessResetRequested.exchange(false, std::memory_order_acq_rel) || transportStarted)
+        loudnessMeter.reset();
+}
+
+template <size_t NumChannels>
 void GuideLinesCompAudioProcessor::updateRMSLevels(const juce::AudioBuffer<float>& buffer,
-    RmsMeasurement& rmsLevelLeft,
-    RmsMeasurement& rmsLevelRight)
+    TelemetryRecord::StereoLevel& rmsLevel)
 {
-    const int numChannels = buffer.getNumChannels();
     const int numSamples = buffer.getNumSamples();
+    if (numSamples == 0)
+        return;
+
+    const int numChannels = NumChannels > 0 ? (int)NumChannels : juce::jmin(buffer.getNumChannels(), 2);
+
+    // Sums stay in locals; the record only sees the finished RMS
+    std::array<float, 2> sumOfSquares{};
 
     for (int ch = 0; ch < numChannels; ++ch)
     {
         const float* data = buffer.getReadPointer(ch);
+        float sum = 0.0f;
         for (int i = 0; i < numSamples; ++i)
-        {
-            float sample = data[i];
-            if (ch == 0)
-                rmsLevelLeft.update(sample);
-            else if (ch == 1)
-                rmsLevelRight.update(sample);
-        }
+            sum += data[i] * data[i];
+
+        sumOfSquares[(size_t)ch] = sum;
     }
+
+    // A single channel is shown on both sides of the meters
+    if (numChannels == 1)
+        sumOfSquares[1] = sumOfSquares[0];
+
+    rmsLevel.left = std::sqrt(sumOfSquares[0] / numSamples);
+    rmsLevel.right = std::sqrt(sumOfSquares[1] / numSamples);
 }
 
-void GuideLinesCompAudioProcessor::updatePeakLevels(
-    const juce::AudioBuffer<float>& buffer,
-    Measurement& peakLevelLeft,
-    Measurement& peakLevelRight)
+template <size_t NumChannels>
+void GuideLinesCompAudioProcessor::updatePeakLevels(const juce::AudioBuffer<float>& buffer,
+    TelemetryRecord::StereoLevel& peakLevel)
 {
-    const int numChannels = buffer.getNumChannels();
     const int numSamples = buffer.getNumSamples();
+    const int numChannels = NumChannels > 0 ? (int)NumChannels : juce::jmin(buffer.getNumChannels(), 2);
+
+    std::array<float, 2> peaks{};
 
     for (int ch = 0; ch < numChannels; ++ch)
     {
         const float* data = buffer.getReadPointer(ch);
-
         for (int i = 0; i < numSamples; ++i)
-        {
-            const float absSample = std::fabs(data[i]);
-
-            if (ch == 0)
-                peakLevelLeft.updateIfGreater(absSample);
-            else if (ch == 1)
-                peakLevelRight.updateIfGreater(absSample);
-        }
+            peaks[(size_t)ch] = juce::jmax(peaks[(size_t)ch], std::fabs(data[i]));
     }
 
-    peakLevelLeft.updateSmoothed();
-    peakLevelRight.updateSmoothed();
-}
\ No newline at end of file
+    if (numChannels == 1)
+        peaks[1] = peaks[0];
+
+    peakLevel.left = peaks[0];
+    peakLevel.right = peaks[1];
+}
+
+void GuideLinesCompAudioProcessor::publishFrameLevels(const FrameLevels& levels, size_t numFrames,
+    TelemetryRecord::StereoLevel& rmsLevel)
+{
+    if (numFrames == 0)
+        return;
+
+    rmsLevel.left = std::sqrt(levels.sumOfSquares.get(0) / (float)numFrames);
+    rmsLevel.right = std::sqrt(levels.sumOfSquares.get(1) / (float)numFrames);
+}
+
+void GuideLinesCompAudioProcessor::publishFramePeaks(const FrameLevels& levels,
+    TelemetryRecord::StereoLevel& peakLevel)
+{
+    peakLevel.left = levels.peak.get(0);
+    peakLevel.right = levels.peak.get(1);
+}
+
+void GuideLinesCompAudioProcessor::publishTelemetry()
+{
+    auto gainReduction = [](float input, float output)
+    {
+        return (input > 0.0f && output > 0.0f) ? output / input : 1.0f;
+    };
+
+    auto reductionDb = [](float input, float output)
+    {
+        return juce::Decibels::gainToDecibels(input) - juce::Decibels::gainToDecibels(output);
+    };
+
+    telemetry.gainReduction.left = gainReduction(telemetry.inputRms.left, telemetry.compBOutputRms.left);
+    telemetry.gainReduction.right = gainReduction(telemetry.inputRms.right, telemetry.compBOutputRms.right);
+
+    telemetry.compAGainReductionDb = juce::jmax(
+        reductionDb(telemetry.inputRms.left, telemetry.compAOutputRms.left),
+        reductionDb(telemetry.inputRms.right, telemetry.compAOutputRms.right));
+    telemetry.compBGainReductionDb = juce::jmax(
+        reductionDb(telemetry.compAOutputRms.left, telemetry.compBOutputRms.left),
+        reductionDb(telemetry.compAOutputRms.right, telemetry.compBOutputRms.right));
+
+    // A full ring just means nobody is watching; the record is dropped
+    telemetryRing.push(telemetry);
+}
@@ -14,16 +14,27 @@
 #include "Service/Parameters.h"
 #include "Service/ProtectYourEars.h"
 #include "Service/PresetManager.h"
+#include "Service/PresetFile.h"
+#include "Service/SnapshotBank.h"
 #include "DSP/CompressorUnit.h"
 #include "DSP/OptoCompressorUnit.h"
-#include "Service/Measurement.h"
-#include "Service/RmsMeasurement.h"
+#include "DSP/CompressorMapping.h"
+#include "DSP/LowCutStage.h"
+#include "DSP/TruePeakLimiter.h"
+#include "DSP/LoudnessMeter.h"
+#include "DSP/FrameProcessing.h"
+#include "DSP/ScratchArena.h"
+#include "Service/TelemetryRing.h"
+#include "Service/WaveformPyramid.h"
+#include "Service/SpectrumAnalyzer.h"
 
 
 //==============================================================================
 /**
 */
-class GuideLinesCompAudioProcessor : public juce::AudioProcessor
+class GuideLinesCompAudioProcessor : public juce::AudioProcessor,
+    private juce::AudioProcessorValueTreeState::Listener,
+    private juce::AsyncUpdater
 {
 public:
     //==============================================================================
@@ -72,30 +83,69 @@ public:
     CompressorUnit compA;
     OptoCompressorUnit compB;
 
-    RmsMeasurement rmsInputLevelLeft;
-    RmsMeasurement rmsInputLevelRight;
-    Measurement peakInputLevelRight;
-    Measurement peakInputLevelLeft;
-    RmsMeasurement rmsOutputLevelLeft;
-    RmsMeasurement rmsOutputLevelRight;
-    Measurement peakOutputLevelRight;
-    Measurement peakOutputLevelLeft;
-
-    RmsMeasurement rmsTotalGainReductionLeft;
-    RmsMeasurement rmsTotalGainReductionRight;
-
-    float getPeakInputLevelForKnob() const noexcept { return peakInputLevelForKnob.load(); }
-    float getCompressionAmountForKnob() const noexcept { return compressionAmountForKnob.load(); }
-    float getPeakOutputLevelForKnob() const noexcept { return peakOutputLevelForKnob.load(); }
+    /// Per-block levels for the editor; only the editor may drain it.
+    TelemetryRing& getTelemetry() noexcept { return telemetryRing; }
     Service::PresetManager& getPresetManager() { return *presetManager; }
+    Service::SnapshotBank& getSnapshotBank() noexcept { return snapshotBank; }
+    const ProtectYourEars& getOutputSafety() const noexcept { return outputSafety; }
+    const LoudnessMeter& getLoudnessMeter() const noexcept { return loudnessMeter; }
+    const WaveformPyramid& getWaveformPyramid() const noexcept { return waveformPyramid; }
+    SpectrumAnalyzer& getSpectrumAnalyzer() noexcept { return spectrumAnalyzer; }
+
+    /**
+        Called by an editor whenever it is shown or hidden; every call with true must later be
+        matched by one with false. Level metering, telemetry, the waveform history and the
+        spectrum analysis only run while at least one editor is visible.
+    */
+    void setEditorVisible(bool isVisible) noexcept
+    {
+        const int change = isVisible ? 1 : -1;
+        const int numVisible = visibleEditors.fetch_add(change, std::memory_order_acq_rel) + change;
+        jassert(numVisible >= 0);
+
+        spectrumAnalyzer.setActive(numVisible > 0);
+    }
+
+    /// Restarts the integrated loudness and LRA on the next block. Safe to call from any thread.
+    void resetLoudness() noexcept { loudnessResetRequested.store(true, std::memory_order_release); }
+
+    /// Editor zoom relative to its base size. Saved with the session, but not in presets.
+    float getEditorScale() const noexcept { return editorScale.load(std::memory_order_relaxed); }
+    void setEditorScale(float newScale) noexcept { editorScale.store(newScale, std::memory_order_relaxed); }
 
 private:
 
     std::unique_ptr<Service::PresetManager> presetManager;
-    juce::dsp::StateVariableTPTFilter<float> lowCutFilter;
+    Service::SnapshotBank snapshotBank{ apvts };   ///< A/B/C/D slots, handed to the audio thread without locks
+
+    /// Runs non-realtime helpers such as the linear-phase kernel designer.
+    juce::TimeSliceThread backgroundThread{ "GuideLinesComp Background" };
+
+    LowCutStage lowCut;       ///< IIR or linear-phase low cut; only linear phase adds latency
     float lastLowCut = -1.f;
+    std::atomic<bool> linearPhaseEngaged{ false };   ///< Set on the message thread together with the reported latency
+
+    int detectorDecimationFactor = 1;     ///< Control-rate divider used when detector decimation is on
+    bool lastDetectorDecimation = false;
 
     juce::dsp::Gain<float> outputGainProcessor;
+    TruePeakLimiter outputLimiter;   ///< Always delays by its lookahead; limits only while engaged
+    ProtectYourEars outputSafety;     ///< NaN/Inf containment and soft ceiling on the final output
+    LoudnessMeter loudnessMeter;      ///< BS.1770 loudness of the final output, gated on backgroundThread
+    std::atomic<bool> loudnessResetRequested{ false };   ///< Set by resetLoudness(), taken by the audio thread
+    bool wasPlaying = false;          ///< Host transport state of the previous block
+    WaveformPyramid waveformPyramid;  ///< Input/output min/max history, built on backgroundThread
+    SpectrumAnalyzer spectrumAnalyzer;  ///< Pre/post FFT on backgroundThread while an editor shows it
+
+    ScratchArena scratchArena;    ///< Scratch memory of every stage, sized in prepareToPlay
+    int maxChunkSize = 0;         ///< Largest block the stages are prepared for; bigger host blocks are split
+
+    FrameBuffer frameBuffer;      ///< Interleaved L/R frames for the frame chain
+    bool useFrameChain = false;   ///< Chosen in prepareToPlay from the main bus layout
+
+    /// Planar chain specialised for the main bus channel count, chosen in prepareToPlay.
+    using PlanarChain = void (GuideLinesCompAudioProcessor::*)(juce::AudioBuffer<float>&);
+    PlanarChain planarChain = nullptr;
 
     float bypassFade = 1.0f;
     float bypassFadeInc = 0.0f;
@@ -106,16 +156,14 @@ private:
     float controlReleaseA = 55.0f;
     float compressRatioA = 2.0f;
 
-    std::atomic<float> compAGainReductionDbLeft{ 0.0f };
-    std::atomic<float> compAGainReductionDbRight{ 0.0f };
+    TelemetryRecord telemetry;      ///< Filled in by the chain while a chunk is processed
+    TelemetryRing telemetryRing;    ///< One record per chunk, drained by the editor
 
-    RmsMeasurement rmsCompAOutputLeft;
-    RmsMeasurement rmsCompAOutputRight;
-    RmsMeasurement rmsCompBOutputLeft;
-    RmsMeasurement rmsCompBOutputRight;
+    std::atomic<int> visibleEditors{ 0 };       ///< Editors currently showing, counted on the message thread
+    std::atomic<float> editorScale{ 1.0f };     ///< Hosts may save state off the message thread
 
-    std::atomic<float> compBGainReductionDbLeft{ 0.0f };
-    std::atomic<float> compBGainReductionDbRight{ 0.0f };
+    static inline const juce::Identifier editorScaleProperty{ "editorScale" };
+    bool meteringActive = false;                ///< Audio thread copy, latched once per chunk
 
     juce::LinearSmoothedValue<float> compressInputGainSmoother = 1.0f;
     juce::LinearSmoothedValue<float> controlAttackASmoother = 50.0f;
@@ -123,18 +171,37 @@ private:
     juce::LinearSmoothedValue<float> compressRatioASmoother = 2.0f;
     juce::LinearSmoothedValue<float> controlReleaseASmoother = 55.0f;
 
-    std::atomic<float> peakInputLevelForKnob{ 0.0f };
-    std::atomic<float> compressionAmountForKnob{ 0.0f };
-    std::atomic<float> peakOutputLevelForKnob{ 0.0f };
-
+    void processChunk(juce::AudioBuffer<float>& buffer);
     void initializeProcessing(juce::AudioBuffer<float>& buffer);
 
     void updateBypassState();
     void updateLowCutFilter();
+    void updateLimiter();
+    int getChainLatency(bool linearPhase) const noexcept;
+
+    /// Takes over the linear-phase switch and reports the latency it implies. Message thread.
+    void updateLinearPhase();
+    void parameterChanged(const juce::String& parameterID, float newValue) override;
+    void handleAsyncUpdate() override;
+    void updateDetectorDecimation();
     void updateMappedCompressorParameters();
-
-    void updateRMSLevels(const juce::AudioBuffer<float>& buffer, RmsMeasurement& rmsLevelLeft, RmsMeasurement& rmsLevelRight);
-    void updatePeakLevels(const juce::AudioBuffer<float>& buffer, Measurement& peakLevelLeft, Measurement& peakLevelRight);
+    void updateMeteringState() noexcept;
+    void updateLoudnessReset() noexcept;
+
+    bool isDualMono(const juce::AudioBuffer<float>& mainOutput, int numInputChannels) const noexcept;
+    void resetProcessingState() noexcept;
+
+    template <size_t NumChannels>
+    void processPlanarChain(juce::AudioBuffer<float>& mainOutput);
+    void processFrameChain(juce::AudioBuffer<float>& mainOutput);
+
+    template <size_t NumChannels>
+    void updateRMSLevels(const juce::AudioBuffer<float>& buffer, TelemetryRecord::StereoLevel& rmsLevel);
+    template <size_t NumChannels>
+    void updatePeakLevels(const juce::AudioBuffer<float>& buffer, TelemetryRecord::StereoLevel& peakLevel);
+    void publishFrameLevels(const FrameLevels& levels, size_t numFrames, TelemetryRecord::StereoLevel& rmsLevel);
+    void publishFramePeaks(const FrameLevels& levels, TelemetryRecord::StereoLevel& peakLevel);
+    void publishTelemetry();
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(GuideLinesCompAudioProcessor)
 };
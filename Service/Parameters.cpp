@@ -67,6 +67,9 @@ Parameters::Parameters(juce::AudioProcessorValueTreeState& apvts)
     castParameter(apvts, bypassParamID, bypassParam);
     castParameter(apvts, controlParamID, controlParam);
     castParameter(apvts, compressionParamID, compressionParam);
+    castParameter(apvts, lowCutLinearPhaseParamID, lowCutLinearPhaseParam);
+    castParameter(apvts, detectorDecimationParamID, detectorDecimationParam);
+    castParameter(apvts, limiterParamID, limiterParam);
 }
 
 juce::AudioProcessorValueTreeState::ParameterLayout Parameters::createParameterLayout()
@@ -100,6 +103,16 @@ juce::AudioProcessorValueTreeState::ParameterLayout Parameters::createParameterL
         .withValueFromStringFunction(hzFromString)
     ));
 
+    // Not automatable: it changes the plugin latency, which hosts only pick up between edits
+    layout.add(std::make_unique<juce::AudioParameterBool>(
+        lowCutLinearPhaseParamID, "Low Cut Linear Phase", false,
+        juce::AudioParameterBoolAttributes().withAutomatable(false)
+    ));
+
+    layout.add(std::make_unique<juce::AudioParameterBool>(
+        detectorDecimationParamID, "Decimated Detector", false
+    ));
+
     layout.add(std::make_unique<juce::AudioParameterFloat>(
         outputGainParamID, "Output Gain",
         juce::NormalisableRange<float>{ -18.f, 12.f },
@@ -108,6 +121,10 @@ juce::AudioProcessorValueTreeState::ParameterLayout Parameters::createParameterL
         .withStringFromValueFunction(stringFromDecibels)
     ));
 
+    layout.add(std::make_unique<juce::AudioParameterBool>(
+        limiterParamID, "Output Limiter", false
+    ));
+
     layout.add(std::make_unique<juce::AudioParameterBool>(
         bypassParamID, "Bypass", false
     ));
@@ -136,6 +153,10 @@ void Parameters::reset() noexcept
     lowCutSmoother.setCurrentAndTargetValue(lowCutParam->get());
     controlSmoother.setCurrentAndTargetValue(controlParam->get());
     compressionSmoother.setCurrentAndTargetValue(compressionParam->get());
+
+    lowCutLinearPhase = lowCutLinearPhaseParam->get();
+    detectorDecimation = detectorDecimationParam->get();
+    limiter = limiterParam->get();
 }
 
 void Parameters::update() noexcept
@@ -146,6 +167,19 @@ void Parameters::update() noexcept
     compressionSmoother.setTargetValue(compressionParam->get());
 
     bypassed = bypassParam->get();
+    lowCutLinearPhase = lowCutLinearPhaseParam->get();
+    detectorDecimation = detectorDecimationParam->get();
+    limiter = limiterParam->get();
+}
+
+void Parameters::setTargets(const SnapshotValues& values) noexcept
+{
+    auto value = [&values](SnapshotParameter parameter) { return values[(size_t)parameter]; };
+
+    outputGainSmoother.setTargetValue(juce::Decibels::decibelsToGain(value(SnapshotParameter::outputGain)));
+    lowCutSmoother.setTargetValue(value(SnapshotParameter::lowCut));
+    controlSmoother.setTargetValue(value(SnapshotParameter::control));
+    compressionSmoother.setTargetValue(value(SnapshotParameter::compression));
 }
 
 void Parameters::smoothen() noexcept
@@ -11,6 +11,7 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include <array>
 
 //==============================================================================
 /// Unique Parameter IDs used in the plugin's ValueTreeState
@@ -19,6 +20,37 @@ const juce::ParameterID lowCutParamID{ "lowCut", 1 };
 const juce::ParameterID controlParamID{ "control", 1 };
 const juce::ParameterID compressionParamID{ "compression", 1 };
 const juce::ParameterID bypassParamID{ "bypass", 1 };
+const juce::ParameterID lowCutLinearPhaseParamID{ "lowCutLinearPhase", 1 };
+const juce::ParameterID detectorDecimationParamID{ "detectorDecimation", 1 };
+const juce::ParameterID limiterParamID{ "limiter", 1 };
+
+//==============================================================================
+/// Order of the values in a parameter snapshot. Bypass is left out so comparing slots never bypasses.
+enum class SnapshotParameter
+{
+    control,
+    compression,
+    lowCut,
+    lowCutLinearPhase,
+    detectorDecimation,
+    outputGain,
+    limiter,
+    count
+};
+
+/// One value per SnapshotParameter in its parameter's own units, e.g. dB for the output gain.
+using SnapshotValues = std::array<float, (size_t)SnapshotParameter::count>;
+
+/// The parameter behind each SnapshotParameter, in the same order.
+const std::array<juce::ParameterID, (size_t)SnapshotParameter::count> snapshotParameterIDs{
+    controlParamID,
+    compressionParamID,
+    lowCutParamID,
+    lowCutLinearPhaseParamID,
+    detectorDecimationParamID,
+    outputGainParamID,
+    limiterParamID
+};
 
 //==============================================================================
 /**
@@ -59,6 +91,14 @@ public:
     */
     void update() noexcept;
 
+    /**
+        Replaces the targets set by update() with the values of a snapshot, so a whole
+        snapshot ramps in through the smoothers at once. The switches are left to update():
+        their stages fade between settings themselves. Real-time safe.
+        @param values The snapshot to move towards.
+    */
+    void setTargets(const SnapshotValues& values) noexcept;
+
     /**
         Advances the smoothed values by one processing frame and stores them for processing use.
     */
@@ -80,6 +120,15 @@ public:
     /// True if the effect is bypassed, false otherwise.
     bool bypassed = false;
 
+    /// True if the low cut should use the linear-phase FIR path instead of the IIR filter.
+    bool lowCutLinearPhase = false;
+
+    /// True if the compressor detectors should run at a reduced control rate.
+    bool detectorDecimation = false;
+
+    /// True if the true-peak output limiter is engaged.
+    bool limiter = false;
+
     /// Direct access to the bypass parameter (for UI toggling or logic decisions).
     juce::AudioParameterBool* bypassParam = nullptr;
 
@@ -97,6 +146,15 @@ private:
     /// Raw pointer to the compression parameter.
     juce::AudioParameterFloat* compressionParam = nullptr;
 
+    /// Raw pointer to the linear-phase low cut switch.
+    juce::AudioParameterBool* lowCutLinearPhaseParam = nullptr;
+
+    /// Raw pointer to the decimated detector switch.
+    juce::AudioParameterBool* detectorDecimationParam = nullptr;
+
+    /// Raw pointer to the output limiter switch.
+    juce::AudioParameterBool* limiterParam = nullptr;
+
     //==============================================================================
     /// Smoother for output gain to avoid sudden jumps in loudness.
     juce::LinearSmoothedValue<float> outputGainSmoother;
@@ -0,0 +1,255 @@
+/*
+  ==============================================================================
+
+    PresetFile.cpp
+    Created: 19 Oct 2026 1:31:47am
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "PresetFile.h"
+#include <array>
+#include <vector>
+
+namespace Service
+{
+    namespace
+    {
+        /** One step of the state migration: applied to states older than toVersion. */
+        struct Migration
+        {
+            int toVersion;                          ///< Packed version, as ProjectInfo::versionNumber
+            void (*apply)(juce::ValueTree& state);
+        };
+
+        /**
+         * Steps in ascending version order. Append one whenever a release renames,
+         * rescales or removes a parameter, e.g. { 0x010200, [](juce::ValueTree& s) { ... } }.
+         * The parameter layout has not changed since the first release, so it is empty.
+         */
+        const std::vector<Migration>& getMigrations()
+        {
+            static const std::vector<Migration> migrations;
+            return migrations;
+        }
+
+        constexpr std::array<std::uint32_t, 256> makeCrcTable()
+        {
+            std::array<std::uint32_t, 256> table{};
+
+            for (std::uint32_t i = 0; i < 256; ++i)
+            {
+                std::uint32_t crc = i;
+                for (int bit = 0; bit < 8; ++bit)
+                    crc = (crc & 1) != 0 ? 0xedb88320u ^ (crc >> 1) : crc >> 1;
+
+                table[i] = crc;
+            }
+
+            return table;
+        }
+
+        constexpr auto crcTable = makeCrcTable();
+    }
+
+    const juce::Identifier PresetFile::versionProperty{ "version" };
+
+    namespace
+    {
+        const juce::Identifier metadataType{ "Metadata" };
+        const juce::Identifier tagsProperty{ "tags" };
+        const juce::Identifier authorProperty{ "author" };
+    }
+
+    //==============================================================================
+    bool PresetFile::write(const juce::ValueTree& state, const juce::File& file, const Metadata& metadata)
+    {
+        juce::MemoryOutputStream payload;
+        state.writeToStream(payload);
+
+        const auto metadataBlock = encodeMetadata(metadata);
+
+        // Written next to the target and moved over it, so a failed save never leaves half a
+        // preset. The temporary extension keeps it out of the preset index while it is written.
+        const auto temp = file.withFileExtension("tmp");
+        bool written = false;
+
+        {
+            juce::FileOutputStream out{ temp };
+            if (out.openedOk() && out.setPosition(0) && out.truncate().wasOk())
+            {
+                out.writeInt((int)magic);
+                out.writeInt((int)formatVersion);
+                out.writeInt((int)payload.getDataSize());
+                out.writeInt((int)computeCrc32(payload.getData(), payload.getDataSize()));
+                out.writeInt((int)metadataBlock.getSize());
+                out.writeInt((int)computeCrc32(metadataBlock.getData(), metadataBlock.getSize()));
+                out.write(metadataBlock.getData(), metadataBlock.getSize());
+                out.write(payload.getData(), payload.getDataSize());
+                out.flush();
+
+                written = out.getStatus().wasOk();
+            }
+        }
+
+        if (!written || !temp.moveFileTo(file))
+        {
+            temp.deleteFile();
+            return false;
+        }
+
+        return true;
+    }
+
+    PresetFile::Metadata PresetFile::readMetadata(const juce::File& file)
+    {
+        // Only the header and the metadata are read, so scanning a library stays cheap
+        juce::FileInputStream in{ file };
+        if (!in.openedOk() || in.getTotalLength() < headerSize)
+            return {};
+
+        char header[headerSize];
+        if (in.read(header, headerSize) != headerSize
+            || juce::ByteOrder::littleEndianInt(header) != magic
+            || juce::ByteOrder::littleEndianInt(header + 4) < 2
+            || juce::ByteOrder::littleEndianInt(header + 4) > formatVersion)
+            return {};
+
+        const auto metadataSize = (size_t)juce::ByteOrder::littleEndianInt(header + 16);
+        const auto metadataCrc = juce::ByteOrder::littleEndianInt(header + 20);
+
+        if ((juce::int64)metadataSize > in.getTotalLength() - headerSize)
+            return {};
+
+        juce::MemoryBlock block{ metadataSize };
+        if ((size_t)in.read(block.getData(), (int)metadataSize) != metadataSize
+            || computeCrc32(block.getData(), metadataSize) != metadataCrc)
+            return {};
+
+        return decodeMetadata(block.getData(), metadataSize);
+    }
+
+    juce::ValueTree PresetFile::read(const juce::File& file)
+    {
+        juce::MemoryMappedFile mapped{ file, juce::MemoryMappedFile::readOnly };
+
+        if (mapped.getData() != nullptr)
+            return readFromData(mapped.getData(), mapped.getSize());
+
+        // Mapping fails for empty files and on some network shares
+        juce::MemoryBlock contents;
+        if (!file.loadFileAsData(contents))
+            return {};
+
+        return readFromData(contents.getData(), contents.getSize());
+    }
+
+    juce::ValueTree PresetFile::readFromData(const void* data, size_t sizeInBytes)
+    {
+        const auto* bytes = static_cast<const char*>(data);
+        juce::ValueTree state;
+
+        if (sizeInBytes >= (size_t)headerSizeV1 && juce::ByteOrder::littleEndianInt(bytes) == magic)
+        {
+            const auto version = juce::ByteOrder::littleEndianInt(bytes + 4);
+            const auto payloadSize = (size_t)juce::ByteOrder::littleEndianInt(bytes + 8);
+            const auto crc = juce::ByteOrder::littleEndianInt(bytes + 12);
+
+            if (version > formatVersion)
+            {
+                DBG("Preset was written by a newer version of the plugin");
+                return {};
+            }
+
+            // Version 2 puts the metadata between the header and the payload
+            size_t payloadOffset = headerSizeV1;
+            if (version >= 2)
+            {
+                if (sizeInBytes < (size_t)headerSize)
+                    return {};
+
+                payloadOffset = (size_t)headerSize + juce::ByteOrder::littleEndianInt(bytes + 16);
+            }
+
+            if (payloadOffset > sizeInBytes || payloadSize > sizeInBytes - payloadOffset
+                || computeCrc32(bytes + payloadOffset, payloadSize) != crc)
+            {
+                DBG("Preset data is damaged");
+                return {};
+            }
+
+            state = juce::ValueTree::readFromData(bytes + payloadOffset, payloadSize);
+        }
+        else
+        {
+            // Presets of earlier versions are plain XML
+            if (auto xml = juce::parseXML(juce::String::fromUTF8(bytes, (int)sizeInBytes)))
+                state = juce::ValueTree::fromXml(*xml);
+        }
+
+        if (state.isValid())
+            migrate(state);
+
+        return state;
+    }
+
+    //==============================================================================
+    void PresetFile::migrate(juce::ValueTree& state)
+    {
+        const int stateVersion = parseVersion(state.getProperty(versionProperty).toString());
+
+        for (const auto& migration : getMigrations())
+            if (stateVersion < migration.toVersion)
+                migration.apply(state);
+
+        state.setProperty(versionProperty, ProjectInfo::versionString, nullptr);
+    }
+
+    int PresetFile::parseVersion(const juce::String& version)
+    {
+        const auto parts = juce::StringArray::fromTokens(version, ".", "");
+        int packed = 0;
+
+        for (int i = 0; i < 3; ++i)
+            packed = (packed << 8) | juce::jlimit(0, 255, parts[i].getIntValue());
+
+        return packed;
+    }
+
+    juce::MemoryBlock PresetFile::encodeMetadata(const Metadata& metadata)
+    {
+        juce::ValueTree tree{ metadataType };
+        tree.setProperty(tagsProperty, metadata.tags.joinIntoString(","), nullptr);
+        tree.setProperty(authorProperty, metadata.author, nullptr);
+
+        juce::MemoryOutputStream out;
+        tree.writeToStream(out);
+        return out.getMemoryBlock();
+    }
+
+    PresetFile::Metadata PresetFile::decodeMetadata(const void* data, size_t sizeInBytes)
+    {
+        const auto tree = juce::ValueTree::readFromData(data, sizeInBytes);
+        if (!tree.hasType(metadataType))
+            return {};
+
+        Metadata metadata;
+        metadata.tags = juce::StringArray::fromTokens(tree[tagsProperty].toString(), ",", "");
+        metadata.tags.trim();
+        metadata.tags.removeEmptyStrings();
+        metadata.author = tree[authorProperty].toString();
+        return metadata;
+    }
+
+    std::uint32_t PresetFile::computeCrc32(const void* data, size_t sizeInBytes) noexcept
+    {
+        const auto* bytes = static_cast<const std::uint8_t*>(data);
+        std::uint32_t crc = 0xffffffffu;
+
+        for (size_t i = 0; i < sizeInBytes; ++i)
+            crc = crcTable[(crc ^ bytes[i]) & 0xff] ^ (crc >> 8);
+
+        return crc ^ 0xffffffffu;
+    }
+} // namespace Service
@@ -0,0 +1,117 @@
+/*
+  ==============================================================================
+
+    PresetFile.h
+    Created: 19 Oct 2026 1:31:47am
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <cstdint>
+
+namespace Service
+{
+    /**
+     * @class PresetFile
+     * @brief Reads and writes preset files.
+     *
+     * Presets are stored as a little-endian header, a metadata block and the state in
+     * juce::ValueTree's binary stream format:
+     *
+     *  | bytes | field                                   |
+     *  |-------|-----------------------------------------|
+     *  | 0-3   | magic, "GLCP"                           |
+     *  | 4-7   | format version                          |
+     *  | 8-11  | payload size in bytes                   |
+     *  | 12-15 | CRC-32 of the payload                   |
+     *  | 16-19 | metadata size in bytes (version 2)      |
+     *  | 20-23 | CRC-32 of the metadata (version 2)      |
+     *
+     * The metadata block follows the header and the payload follows the metadata, so tags
+     * can be read without decoding the state. Version 1 files have the 16 byte header only.
+     * Files are memory-mapped for reading, so loading costs one checksum pass and the
+     * ValueTree decode. Files without the magic are read as the XML presets of earlier
+     * versions. Every state that is read goes through migrate() before it is returned.
+     */
+    class PresetFile
+    {
+    public:
+        static constexpr std::uint32_t magic = 0x50434c47;   ///< "GLCP" as read little-endian
+        static constexpr std::uint32_t formatVersion = 2;    ///< Layout written by write()
+        static constexpr int headerSizeV1 = 16;
+        static constexpr int headerSize = 24;
+
+        /** Searchable information stored in front of the state. */
+        struct Metadata
+        {
+            juce::StringArray tags;
+            juce::String author;
+        };
+
+        /** The ValueTree property holding the plugin version that wrote a state. */
+        static const juce::Identifier versionProperty;
+
+        /**
+         * @brief Writes a state as a binary preset, replacing the file only once it is complete.
+         * @param state    The state to store.
+         * @param file     Destination file.
+         * @param metadata Tags and author stored in front of the state.
+         * @return True on success.
+         */
+        static bool write(const juce::ValueTree& state, const juce::File& file, const Metadata& metadata = {});
+
+        /**
+         * @brief Reads only the metadata block of a preset. Safe to call from any thread.
+         * @param file The preset file.
+         * @return The metadata; empty for XML and version 1 presets or damaged files.
+         */
+        static Metadata readMetadata(const juce::File& file);
+
+        /**
+         * @brief Reads a binary or legacy XML preset. Safe to call from any thread.
+         * @param file The preset file.
+         * @return The migrated state, or an invalid tree if the file is missing or damaged.
+         */
+        static juce::ValueTree read(const juce::File& file);
+
+        /**
+         * @brief Decodes a preset held in memory.
+         * @param data        Start of the file contents.
+         * @param sizeInBytes Size of the file contents.
+         * @return The migrated state, or an invalid tree if the data is damaged.
+         */
+        static juce::ValueTree readFromData(const void* data, size_t sizeInBytes);
+
+        /**
+         * @brief Brings a state written by an older plugin version up to date.
+         *
+         * Migration steps run in order for every step newer than the state's version
+         * property; afterwards the property holds the current version.
+         * @param state The state to update in place.
+         */
+        static void migrate(juce::ValueTree& state);
+
+        /**
+         * @brief Converts a "major.minor.patch" string to ProjectInfo::versionNumber's 0xMMmmpp layout.
+         * @param version The version string; missing parts count as 0.
+         * @return The packed version number.
+         */
+        static int parseVersion(const juce::String& version);
+
+    private:
+        /** Encodes metadata as a small ValueTree stream. */
+        static juce::MemoryBlock encodeMetadata(const Metadata& metadata);
+
+        /** Decodes a metadata block; empty metadata if it is damaged. */
+        static Metadata decodeMetadata(const void* data, size_t sizeInBytes);
+
+        /** @return The CRC-32 (IEEE 802.3) of a block of memory. */
+        static std::uint32_t computeCrc32(const void* data, size_t sizeInBytes) noexcept;
+
+        PresetFile() = delete;
+    };
+}
@@ -0,0 +1,261 @@
+/*
+  ==============================================================================
+
+    PresetIndex.cpp
+    Created: 19 Oct 2026 1:05:12am
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "PresetIndex.h"
+#include "PresetManager.h"
+#include "PresetFile.h"
+#include <algorithm>
+#include <map>
+#include <numeric>
+
+namespace Service
+{
+    int PresetIndex::Snapshot::indexOf(const juce::String& name) const
+    {
+        const auto it = positions.find(name);
+        return it != positions.end() ? it->second : -1;
+    }
+
+    //==============================================================================
+    PresetIndex::PresetIndex()
+        : juce::Thread("GuideLinesComp Preset Index"),
+          snapshot(std::make_shared<const Snapshot>())
+    {
+        startThread(juce::Thread::Priority::background);
+    }
+
+    PresetIndex::~PresetIndex()
+    {
+        stopThread(2000);
+    }
+
+    //==============================================================================
+    std::shared_ptr<const PresetIndex::Snapshot> PresetIndex::getSnapshot() const
+    {
+        const juce::ScopedLock lock(snapshotLock);
+        return snapshot;
+    }
+
+    void PresetIndex::addPreset(const juce::String& presetName, const juce::StringArray& tags)
+    {
+        const juce::ScopedLock lock(snapshotLock);
+
+        const int index = snapshot->indexOf(presetName);
+        if (index >= 0 && snapshot->tags[(size_t)index] == tags)
+            return;
+
+        auto updated = std::make_shared<Snapshot>();
+        updated->names = snapshot->names;
+        updated->tags = snapshot->tags;
+
+        if (index >= 0)
+        {
+            updated->tags[(size_t)index] = tags;
+        }
+        else
+        {
+            updated->names.add(presetName);
+            updated->tags.push_back(tags);
+        }
+
+        buildLookups(*updated);
+        publish(std::move(updated));
+    }
+
+    void PresetIndex::removePreset(const juce::String& presetName)
+    {
+        const juce::ScopedLock lock(snapshotLock);
+
+        const int index = snapshot->indexOf(presetName);
+        if (index < 0)
+            return;
+
+        auto updated = std::make_shared<Snapshot>();
+        updated->names = snapshot->names;
+        updated->names.remove(index);
+        updated->tags = snapshot->tags;
+        updated->tags.erase(updated->tags.begin() + index);
+
+        buildLookups(*updated);
+        publish(std::move(updated));
+    }
+
+    void PresetIndex::requestRescan()
+    {
+        rescanRequested.store(true);
+        notify();
+    }
+
+    //==============================================================================
+    /**
+     * @brief Scanning loop.
+     *
+     * Adding, removing or renaming a file updates its directory's modification time, so one
+     * stat per poll is enough to notice changes made by other instances or outside the plugin.
+     * A scan that raced with addPreset()/removePreset() is thrown away and repeated, so a local
+     * change is never overwritten by an older listing.
+     */
+    void PresetIndex::run()
+    {
+        while (!threadShouldExit())
+        {
+            const auto modified = PresetManager::defaultDirectory.getLastModificationTime();
+
+            if (rescanRequested.exchange(false) || modified != scannedModificationTime)
+            {
+                scannedModificationTime = modified;
+
+                const int versionBeforeScan = getVersion();
+                auto scanned = scanDirectory();
+
+                const juce::ScopedLock lock(snapshotLock);
+
+                if (getVersion() != versionBeforeScan)
+                    rescanRequested.store(true);
+                else if (scanned->names != snapshot->names || scanned->tags != snapshot->tags)
+                    publish(std::move(scanned));
+            }
+
+            wait(rescanRequested.load() ? 0 : pollIntervalMs);
+        }
+    }
+
+    std::shared_ptr<PresetIndex::Snapshot> PresetIndex::scanDirectory()
+    {
+        auto scanned = std::make_shared<Snapshot>();
+        std::unordered_map<juce::String, CachedTags> seen;
+
+        for (const auto& entry : juce::RangedDirectoryIterator(PresetManager::defaultDirectory, false,
+                 "*." + PresetManager::extension, juce::File::findFiles))
+        {
+            const auto name = entry.getFile().getFileNameWithoutExtension();
+            const auto modified = entry.getModificationTime();
+
+            // Headers are only read for new or changed files
+            auto cached = tagCache.find(name);
+            if (cached == tagCache.end() || cached->second.modified != modified)
+                cached = tagCache.insert_or_assign(name, CachedTags{ modified, readTags(entry.getFile()) }).first;
+
+            scanned->names.add(name);
+            scanned->tags.push_back(cached->second.tags);
+            seen.emplace(name, cached->second);
+        }
+
+        tagCache = std::move(seen);
+
+        buildLookups(*scanned);
+        return scanned;
+    }
+
+    juce::StringArray PresetIndex::readTags(const juce::File& file)
+    {
+        return PresetFile::readMetadata(file).tags;
+    }
+
+    /**
+     * @brief Sorts a snapshot and builds its lookups.
+     *
+     * Every word of a preset's name and tags becomes a term. Terms are kept sorted so a
+     * prefix selects one contiguous range, and each term lists its presets in name order.
+     */
+    void PresetIndex::buildLookups(Snapshot& snapshotToIndex)
+    {
+        auto& names = snapshotToIndex.names;
+        auto& tags = snapshotToIndex.tags;
+        const int numPresets = names.size();
+        jassert((int)tags.size() == numPresets);
+
+        std::vector<int> order((size_t)numPresets);
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(),
+            [&names](int a, int b) { return names[a].compareNatural(names[b]) < 0; });
+
+        juce::StringArray sortedNames;
+        std::vector<juce::StringArray> sortedTags;
+        sortedNames.ensureStorageAllocated(numPresets);
+        sortedTags.reserve((size_t)numPresets);
+
+        for (const int i : order)
+        {
+            sortedNames.add(names[i]);
+            sortedTags.push_back(std::move(tags[(size_t)i]));
+        }
+
+        names = std::move(sortedNames);
+        tags = std::move(sortedTags);
+
+        snapshotToIndex.positions.clear();
+        snapshotToIndex.positions.reserve((size_t)numPresets);
+
+        std::map<juce::String, std::vector<int>> termPostings;
+
+        for (int i = 0; i < numPresets; ++i)
+        {
+            snapshotToIndex.positions.emplace(names[i], i);
+
+            auto words = splitIntoTerms(names[i]);
+            for (const auto& tag : tags[(size_t)i])
+                words.addArray(splitIntoTerms(tag));
+
+            words.removeDuplicates(false);
+
+            for (const auto& word : words)
+                termPostings[word].push_back(i);
+        }
+
+        snapshotToIndex.terms.clearQuick();
+        snapshotToIndex.postings.clear();
+        snapshotToIndex.presetTerms.assign((size_t)numPresets, {});
+
+        for (auto& [term, presets] : termPostings)
+        {
+            const int termIndex = snapshotToIndex.terms.size();
+
+            for (const int preset : presets)
+                snapshotToIndex.presetTerms[(size_t)preset].push_back(termIndex);
+
+            snapshotToIndex.terms.add(term);
+            snapshotToIndex.postings.push_back(std::move(presets));
+        }
+    }
+
+    juce::StringArray PresetIndex::splitIntoTerms(const juce::String& text)
+    {
+        juce::StringArray terms;
+        juce::String current;
+        const auto lowerCase = text.toLowerCase();
+
+        for (auto p = lowerCase.getCharPointer(); !p.isEmpty(); ++p)
+        {
+            const auto c = *p;
+
+            if (juce::CharacterFunctions::isLetterOrDigit(c))
+            {
+                current += c;
+            }
+            else if (current.isNotEmpty())
+            {
+                terms.add(current);
+                current.clear();
+            }
+        }
+
+        if (current.isNotEmpty())
+            terms.add(current);
+
+        return terms;
+    }
+
+    void PresetIndex::publish(std::shared_ptr<const Snapshot> newSnapshot)
+    {
+        snapshot = std::move(newSnapshot);
+        version.fetch_add(1, std::memory_order_release);
+    }
+} // namespace Service
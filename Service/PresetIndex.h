@@ -0,0 +1,130 @@
+/*
+  ==============================================================================
+
+    PresetIndex.h
+    Created: 19 Oct 2026 1:05:12am
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <atomic>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace Service
+{
+    /**
+     * @class PresetIndex
+     * @brief Process-wide, sorted list of the preset names in PresetManager::defaultDirectory.
+     *
+     * Hold it through a juce::SharedResourcePointer so every plugin instance in the process
+     * shares one index and one scanning thread. The thread polls the directory's modification
+     * time and only lists the directory again when it changed, so the message thread never
+     * touches the file system to enumerate presets. Readers get an immutable snapshot in O(1);
+     * the version number changes whenever a new snapshot is published.
+     *
+     * Each snapshot also holds the tags of every preset and an inverted index over the
+     * words of names and tags, which PresetSearch queries. Tags are read from
+     * the preset headers and only again when a file's modification time changed.
+     */
+    class PresetIndex : private juce::Thread
+    {
+    public:
+        /** Sorted preset names and their search terms. Never changes once published. */
+        struct Snapshot
+        {
+            juce::StringArray names;
+            std::vector<juce::StringArray> tags;              ///< Per preset, in the order of names
+            std::unordered_map<juce::String, int> positions;
+
+            juce::StringArray terms;                          ///< Lower-case words, sorted
+            std::vector<std::vector<int>> postings;           ///< Per term: presets containing it, ascending
+            std::vector<std::vector<int>> presetTerms;        ///< Per preset: its terms
+
+            /** @return The position of name in names, or -1 if it is not in the index. */
+            int indexOf(const juce::String& name) const;
+        };
+
+        /** Starts the scanning thread. The first snapshot is empty until the initial scan is done. */
+        PresetIndex();
+
+        /** Stops the scanning thread. */
+        ~PresetIndex() override;
+
+        /**
+         * @brief Gets the newest snapshot. Cheap and safe to call from any non-audio thread.
+         * @return The current snapshot; never nullptr.
+         */
+        std::shared_ptr<const Snapshot> getSnapshot() const;
+
+        /** @return A number that changes every time a new snapshot is published. */
+        int getVersion() const noexcept { return version.load(std::memory_order_acquire); }
+
+        /**
+         * @brief Adds or updates a preset that was just saved, without waiting for the next scan.
+         * @param presetName Name of the saved preset.
+         * @param tags       Tags stored in its header.
+         */
+        void addPreset(const juce::String& presetName, const juce::StringArray& tags);
+
+        /**
+         * @brief Removes a preset that was just deleted, without waiting for the next scan.
+         * @param presetName Name of the deleted preset.
+         */
+        void removePreset(const juce::String& presetName);
+
+        /** Asks the thread to list the directory again even if its timestamp did not change. */
+        void requestRescan();
+
+        /**
+         * @brief Splits text into the lower-case words the index is built from.
+         * @param text A preset name, a tag or a search query.
+         * @return The words, in order; letters and digits only.
+         */
+        static juce::StringArray splitIntoTerms(const juce::String& text);
+
+        /**
+         * @brief Sorts names and tags together and rebuilds the lookups of a snapshot.
+         * @param snapshot A snapshot whose names and tags are filled in, e.g. one built in memory by a benchmark.
+         */
+        static void buildLookups(Snapshot& snapshot);
+
+        static constexpr int pollIntervalMs = 1000;   ///< Interval between directory timestamp checks
+
+    private:
+        /** Polls the directory timestamp and rescans when it moved or a rescan was requested. */
+        void run() override;
+
+        /** @return A snapshot of the presets currently on disk. Scanning thread only. */
+        std::shared_ptr<Snapshot> scanDirectory();
+
+        /** @return The tags stored in the header of a preset file. */
+        static juce::StringArray readTags(const juce::File& file);
+
+        /** Makes snapshot the current one and bumps the version. Caller holds snapshotLock. */
+        void publish(std::shared_ptr<const Snapshot> newSnapshot);
+
+        std::shared_ptr<const Snapshot> snapshot;
+        mutable juce::CriticalSection snapshotLock;
+        std::atomic<int> version{ 0 };
+        std::atomic<bool> rescanRequested{ true };
+
+        juce::Time scannedModificationTime;   ///< Directory timestamp of the last scan; scanning thread only
+
+        /** Tags of a file as of its modification time, so unchanged files are not read again. */
+        struct CachedTags
+        {
+            juce::Time modified;
+            juce::StringArray tags;
+        };
+
+        std::unordered_map<juce::String, CachedTags> tagCache;   ///< Scanning thread only
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PresetIndex)
+    };
+}
@@ -0,0 +1,242 @@
+/*
+  ==============================================================================
+
+    PresetLoader.cpp
+    Created: 19 Oct 2026 2:14:36am
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "PresetLoader.h"
+#include "PresetFile.h"
+#include "PresetManager.h"
+#include <algorithm>
+#include <utility>
+
+namespace Service
+{
+    PresetLoader::Worker::Worker()
+        : juce::TimeSliceThread("GuideLinesComp Preset Loader")
+    {
+        startThread(juce::Thread::Priority::low);
+    }
+
+    PresetLoader::Worker::~Worker()
+    {
+        stopThread(2000);
+    }
+
+    //==============================================================================
+    PresetLoader::PresetLoader(LoadedCallback onLoaded)
+        : loadedCallback(std::move(onLoaded))
+    {
+        jassert(loadedCallback != nullptr);
+        worker->addTimeSliceClient(this);
+    }
+
+    PresetLoader::~PresetLoader()
+    {
+        worker->removeTimeSliceClient(this);
+        cancelPendingUpdate();
+    }
+
+    //==============================================================================
+    void PresetLoader::load(const juce::String& presetName)
+    {
+        JUCE_ASSERT_MESSAGE_THREAD
+
+        bool cached = false;
+
+        {
+            const juce::ScopedLock sl(lock);
+            pendingPreset = presetName;
+            cached = findEntry(presetName) != nullptr;
+        }
+
+        if (cached)
+        {
+            cancelPendingUpdate();
+            handleAsyncUpdate();
+        }
+        else
+        {
+            worker->moveToFrontOfQueue(this);
+        }
+    }
+
+    void PresetLoader::prefetch(const juce::StringArray& presetNames)
+    {
+        {
+            const juce::ScopedLock sl(lock);
+            prefetchTargets = presetNames;
+
+            // Keep only what can still be asked for
+            cache.erase(std::remove_if(cache.begin(), cache.end(), [this](const Entry& entry)
+                {
+                    return entry.name != pendingPreset && !prefetchTargets.contains(entry.name);
+                }), cache.end());
+        }
+
+        worker->moveToFrontOfQueue(this);
+    }
+
+    void PresetLoader::invalidate(const juce::String& presetName)
+    {
+        const juce::ScopedLock sl(lock);
+        ++generation;
+
+        cache.erase(std::remove_if(cache.begin(), cache.end(),
+            [&presetName](const Entry& entry) { return entry.name == presetName; }), cache.end());
+    }
+
+    void PresetLoader::invalidateChanged()
+    {
+        std::vector<std::pair<juce::String, juce::Time>> cached;
+
+        {
+            const juce::ScopedLock sl(lock);
+            for (const auto& entry : cache)
+                cached.emplace_back(entry.name, entry.modified);
+        }
+
+        // Only a few presets are cached, so checking their files costs a handful of stats
+        for (const auto& [name, modified] : cached)
+            if (PresetManager::defaultDirectory.getChildFile(name + "." + PresetManager::extension)
+                    .getLastModificationTime() != modified)
+                invalidate(name);
+    }
+
+    juce::String PresetLoader::getPendingPreset() const
+    {
+        const juce::ScopedLock sl(lock);
+        return pendingPreset;
+    }
+
+    //==============================================================================
+    int PresetLoader::useTimeSlice()
+    {
+        juce::String name;
+        int readGeneration = 0;
+
+        {
+            const juce::ScopedLock sl(lock);
+            name = getNextToRead();
+            readGeneration = generation;
+        }
+
+        if (name.isEmpty())
+            return prepareNextCopy() ? 0 : idleIntervalMs;
+
+        // The file system, the decode and the copy run without the lock, so requests never wait for them
+        const auto file = PresetManager::defaultDirectory.getChildFile(name + "." + PresetManager::extension);
+        const auto modified = file.getLastModificationTime();
+        auto state = PresetFile::read(file);
+        auto ready = state.createCopy();
+
+        bool requested = false;
+
+        {
+            const juce::ScopedLock sl(lock);
+
+            if (readGeneration != generation)
+                return 0;
+
+            requested = name == pendingPreset;
+
+            if (requested || prefetchTargets.contains(name))
+                cache.push_back({ name, modified, std::move(state), std::move(ready) });
+        }
+
+        if (requested)
+            triggerAsyncUpdate();
+
+        return 0;
+    }
+
+    void PresetLoader::handleAsyncUpdate()
+    {
+        juce::String name;
+        juce::ValueTree state;
+
+        {
+            const juce::ScopedLock sl(lock);
+
+            auto* entry = findEntry(pendingPreset);
+            if (entry == nullptr)
+                return;
+
+            // The apvts takes ownership of what it is given, so it gets the private copy; the worker makes the next one
+            name = pendingPreset;
+            state = entry->ready.isValid() ? std::move(entry->ready) : entry->state.createCopy();
+            entry->ready = {};
+            pendingPreset.clear();
+        }
+
+        worker->moveToFrontOfQueue(this);
+        loadedCallback(name, std::move(state));
+    }
+
+    bool PresetLoader::prepareNextCopy()
+    {
+        juce::String name;
+        juce::ValueTree source;
+        int copyGeneration = 0;
+
+        {
+            const juce::ScopedLock sl(lock);
+
+            for (const auto& entry : cache)
+            {
+                if (entry.state.isValid() && !entry.ready.isValid())
+                {
+                    name = entry.name;
+                    source = entry.state;
+                    copyGeneration = generation;
+                    break;
+                }
+            }
+        }
+
+        if (name.isEmpty())
+            return false;
+
+        // The cached state is never modified, so it can be copied without the lock
+        auto ready = source.createCopy();
+
+        const juce::ScopedLock sl(lock);
+
+        if (copyGeneration == generation)
+            if (auto* entry = findEntry(name); entry != nullptr && !entry->ready.isValid())
+                entry->ready = std::move(ready);
+
+        return true;
+    }
+
+    //==============================================================================
+    juce::String PresetLoader::getNextToRead() const
+    {
+        if (pendingPreset.isNotEmpty() && findEntry(pendingPreset) == nullptr)
+            return pendingPreset;
+
+        for (const auto& target : prefetchTargets)
+            if (findEntry(target) == nullptr)
+                return target;
+
+        return {};
+    }
+
+    const PresetLoader::Entry* PresetLoader::findEntry(const juce::String& presetName) const
+    {
+        for (const auto& entry : cache)
+            if (entry.name == presetName)
+                return &entry;
+
+        return nullptr;
+    }
+
+    PresetLoader::Entry* PresetLoader::findEntry(const juce::String& presetName)
+    {
+        return const_cast<Entry*>(std::as_const(*this).findEntry(presetName));
+    }
+} // namespace Service
@@ -0,0 +1,123 @@
+/*
+  ==============================================================================
+
+    PresetLoader.h
+    Created: 19 Oct 2026 2:14:36am
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <functional>
+#include <vector>
+
+namespace Service
+{
+    /**
+     * @class PresetLoader
+     * @brief Reads presets on a background thread and hands them to the message thread.
+     *
+     * A request is read and decoded by PresetFile on a worker thread shared by all plugin
+     * instances; only the finished state reaches the message thread, through the callback.
+     * The loader also keeps the presets named by prefetch() decoded in a small cache, so
+     * stepping to a neighbour is applied straight away without touching the file system.
+     * Each cached preset holds a private copy of its state, made on the worker, so a
+     * delivery hands over a tree that is ready to apply instead of copying it on the
+     * message thread.
+     */
+    class PresetLoader : private juce::TimeSliceClient,
+        private juce::AsyncUpdater
+    {
+    public:
+        /** Called on the message thread with the requested name and its state; invalid if it could not be read. */
+        using LoadedCallback = std::function<void(const juce::String& presetName, juce::ValueTree state)>;
+
+        /**
+         * @brief Constructs a PresetLoader and registers it with the shared worker thread.
+         * @param onLoaded Receives every finished request.
+         */
+        explicit PresetLoader(LoadedCallback onLoaded);
+
+        /** Destructor. Waits for a read in progress and drops pending requests. */
+        ~PresetLoader() override;
+
+        /**
+         * @brief Requests a preset. Message thread only.
+         *
+         * A cached preset is delivered before this returns; otherwise it is delivered
+         * asynchronously. A newer request replaces one that has not been delivered yet.
+         * @param presetName Name of the preset to load.
+         */
+        void load(const juce::String& presetName);
+
+        /**
+         * @brief Sets the presets to keep decoded in the background, replacing the previous set.
+         * @param presetNames Names of the presets likely to be requested next.
+         */
+        void prefetch(const juce::StringArray& presetNames);
+
+        /**
+         * @brief Forgets the decoded copy of a preset that was changed on disk.
+         * @param presetName Name of the changed preset.
+         */
+        void invalidate(const juce::String& presetName);
+
+        /**
+         * @brief Forgets the decoded presets whose file changed or disappeared since it was read,
+         *        e.g. after another instance saved over one. Unchanged presets stay cached.
+         */
+        void invalidateChanged();
+
+        /** @return The name of the request that has not been delivered yet, or an empty string. */
+        juce::String getPendingPreset() const;
+
+    private:
+        struct Entry
+        {
+            juce::String name;
+            juce::Time modified;     ///< File modification time when it was read
+            juce::ValueTree state;   ///< Never modified once cached; invalid if the file could not be read
+            juce::ValueTree ready;   ///< Private copy of state for the next delivery; made on the worker
+        };
+
+        /** The worker thread, shared by every loader in the process. */
+        struct Worker : public juce::TimeSliceThread
+        {
+            Worker();
+            ~Worker() override;
+        };
+
+        /** Background side: reads the request, then any prefetch target that is not cached yet. */
+        int useTimeSlice() override;
+
+        /** Message thread side: delivers the request if it is cached. */
+        void handleAsyncUpdate() override;
+
+        /** @return The next preset to read, or an empty string if there is nothing to do. Caller holds lock. */
+        juce::String getNextToRead() const;
+
+        /** Makes the private copy of one cached entry that was delivered since. @return False if none was missing. */
+        bool prepareNextCopy();
+
+        /** @return The cached entry of a preset, or nullptr. Caller holds lock. */
+        const Entry* findEntry(const juce::String& presetName) const;
+        Entry* findEntry(const juce::String& presetName);
+
+        LoadedCallback loadedCallback;
+
+        juce::String pendingPreset;
+        juce::StringArray prefetchTargets;
+        std::vector<Entry> cache;
+        int generation = 0;   ///< Bumped by invalidation, so a read that raced with it is dropped
+        mutable juce::CriticalSection lock;
+
+        static constexpr int idleIntervalMs = 500;
+
+        juce::SharedResourcePointer<Worker> worker;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PresetLoader)
+    };
+}
@@ -10,6 +10,7 @@
 */
 
 #include "PresetManager.h"
+#include "PresetFile.h"
 
 namespace Service
 {
@@ -24,7 +25,11 @@ namespace Service
 
     //==============================================================================
     PresetManager::PresetManager(juce::AudioProcessorValueTreeState& apvts)
-        : apvts(apvts)
+        : apvts(apvts),
+          presetLoader([this](const juce::String& presetName, juce::ValueTree state)
+              {
+                  applyPreset(presetName, std::move(state));
+              })
     {
         if (!defaultDirectory.exists())
         {
@@ -48,14 +53,52 @@ namespace Service
 
         currentPreset.setValue(presetName);
 
-        auto xml = apvts.copyState().createXml();
         auto presetFile = defaultDirectory.getChildFile(presetName + "." + extension);
 
-        if (!xml->writeTo(presetFile))
+        // Overwriting keeps the tags and author the preset already had; new presets carry no author
+        auto metadata = PresetFile::readMetadata(presetFile);
+
+        if (!PresetFile::write(apvts.copyState(), presetFile, metadata))
         {
             DBG("Could not create this preset file");
             jassertfalse;
+            return;
         }
+
+        presetLoader.invalidate(presetName);
+        presetIndex->addPreset(presetName, metadata.tags);
+    }
+
+    void PresetManager::setPresetTags(const juce::String& presetName, const juce::StringArray& tags)
+    {
+        if (presetName.isEmpty())
+            return;
+
+        auto presetFile = defaultDirectory.getChildFile(presetName + "." + extension);
+        const auto state = PresetFile::read(presetFile);
+
+        if (!state.isValid())
+        {
+            DBG("Could not read Preset File: " + presetFile.getFullPathName());
+            jassertfalse;
+            return;
+        }
+
+        auto metadata = PresetFile::readMetadata(presetFile);
+        metadata.tags = tags;
+        metadata.tags.trim();
+        metadata.tags.removeEmptyStrings();
+        metadata.tags.removeDuplicates(true);
+
+        if (!PresetFile::write(state, presetFile, metadata))
+        {
+            DBG("Could not write Preset File: " + presetFile.getFullPathName());
+            jassertfalse;
+            return;
+        }
+
+        presetLoader.invalidate(presetName);
+        presetIndex->addPreset(presetName, metadata.tags);
     }
 
     void PresetManager::deletePreset(const juce::String& presetName)
@@ -79,6 +122,8 @@ namespace Service
             return;
         }
 
+        presetLoader.invalidate(presetName);
+        presetIndex->removePreset(presetName);
         currentPreset.setValue("");
     }
 
@@ -87,72 +132,102 @@ namespace Service
         if (presetName.isEmpty())
             return;
 
-        auto presetFile = defaultDirectory.getChildFile(presetName + "." + extension);
+        syncWithIndex();
+        presetLoader.load(presetName);
+    }
 
-        if (!presetFile.existsAsFile())
+    void PresetManager::prefetchNeighbours()
+    {
+        syncWithIndex();
+
+        const auto snapshot = presetIndex->getSnapshot();
+        const int numPresets = snapshot->names.size();
+        const int index = snapshot->indexOf(getSelectedPreset());
+
+        juce::StringArray neighbours;
+
+        if (numPresets > 0)
         {
-            DBG("Preset File: " + presetFile.getFullPathName() + " does not exist");
-            jassertfalse;
-            return;
+            // Same wrap-around as loadPresetAtOffset(), so both steps from here are cached
+            neighbours.add(snapshot->names[index >= 0 ? (index + 1) % numPresets : 0]);
+            neighbours.addIfNotAlreadyThere(snapshot->names[index >= 0 ? (index + numPresets - 1) % numPresets : numPresets - 1]);
         }
 
-        juce::XmlDocument xmlDocument{ presetFile };
-        auto xmlElement = xmlDocument.getDocumentElement();
+        presetLoader.prefetch(neighbours);
+    }
 
-        if (xmlElement == nullptr)
+    void PresetManager::applyPreset(const juce::String& presetName, juce::ValueTree state)
+    {
+        if (!state.isValid())
         {
-            DBG("Failed to load XML from file: " + presetFile.getFullPathName());
+            DBG("Failed to load preset: " + presetName);
             jassertfalse;
             return;
         }
 
-        juce::ValueTree newState = juce::ValueTree::fromXml(*xmlElement);
-        apvts.replaceState(newState);
+        apvts.replaceState(state);
         currentPreset.setValue(presetName);
+        prefetchNeighbours();
     }
 
-    //==============================================================================
-    int PresetManager::loadNextPreset()
+    void PresetManager::syncWithIndex()
     {
-        auto allPresets = getAllPresets();
-        if (allPresets.isEmpty())
-            return -1;
+        // A changed folder may hold different files under the cached names; only those are read again
+        const int version = presetIndex->getVersion();
+        if (version != loaderIndexVersion)
+        {
+            loaderIndexVersion = version;
+            presetLoader.invalidateChanged();
+        }
+    }
 
-        int currentIndex = allPresets.indexOf(currentPreset.toString());
-        int nextIndex = (currentIndex + 1 > allPresets.size() - 1) ? 0 : currentIndex + 1;
+    juce::String PresetManager::getSelectedPreset() const
+    {
+        const auto pending = presetLoader.getPendingPreset();
+        return pending.isNotEmpty() ? pending : currentPreset.toString();
+    }
 
-        loadPreset(allPresets.getReference(nextIndex));
-        return nextIndex;
+    //==============================================================================
+    int PresetManager::loadNextPreset()
+    {
+        return loadPresetAtOffset(1);
     }
 
     int PresetManager::loadPreviousPreset()
     {
-        auto allPresets = getAllPresets();
-        if (allPresets.isEmpty())
+        return loadPresetAtOffset(-1);
+    }
+
+    int PresetManager::loadPresetAtOffset(int offset)
+    {
+        const auto snapshot = presetIndex->getSnapshot();
+        const int numPresets = snapshot->names.size();
+        if (numPresets == 0)
             return -1;
 
-        int currentIndex = allPresets.indexOf(currentPreset.toString());
-        int previousIndex = (currentIndex - 1 < 0) ? allPresets.size() - 1 : currentIndex - 1;
+        // Steps continue from a request still loading; an unknown preset steps to the first or last entry
+        const int currentIndex = snapshot->indexOf(getSelectedPreset());
+        const int start = currentIndex >= 0 ? currentIndex : (offset > 0 ? -1 : 0);
+        const int index = ((start + offset) % numPresets + numPresets) % numPresets;
 
-        loadPreset(allPresets.getReference(previousIndex));
-        return previousIndex;
+        loadPreset(snapshot->names[index]);
+        return index;
     }
 
     //==============================================================================
     juce::StringArray PresetManager::getAllPresets() const
     {
-        juce::StringArray presetList;
-
-        auto fileArray = defaultDirectory.findChildFiles(
-            juce::File::TypesOfFileToFind::findFiles,
-            false,
-            "*." + extension
-        );
+        return presetIndex->getSnapshot()->names;
+    }
 
-        for (const auto& file : fileArray)
-            presetList.add(file.getFileNameWithoutExtension());
+    int PresetManager::getPresetListVersion() const noexcept
+    {
+        return presetIndex->getVersion();
+    }
 
-        return presetList;
+    std::shared_ptr<const PresetIndex::Snapshot> PresetManager::getPresetSnapshot() const
+    {
+        return presetIndex->getSnapshot();
     }
 
     juce::String PresetManager::getCurrentPreset() const
@@ -11,6 +11,8 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "PresetIndex.h"
+#include "PresetLoader.h"
 
 namespace Service
 {
@@ -19,8 +21,10 @@ namespace Service
      * @brief Handles saving, loading, and deleting audio processor presets.
      * The PresetManager is responsible for creating and managing preset files
      * for the plugin. Presets are stored in a default directory based on the
-     * company and project name, and are serialized as XML files using
-     * `AudioProcessorValueTreeState`.
+     * company and project name, and hold the `AudioProcessorValueTreeState`
+     * in the binary format of PresetFile, which also reads older XML presets.
+     * Preset names come from the process-wide PresetIndex, so listing and
+     * stepping through presets never touches the file system.
      */
     class PresetManager : public juce::ValueTree::Listener
     {
@@ -46,6 +50,13 @@ namespace Service
          */
         void savePreset(const juce::String& presetName);
 
+        /**
+         * @brief Replaces the tags stored in a preset's header; the state is left as it is.
+         * @param presetName Name of the preset to tag.
+         * @param tags       The new tags.
+         */
+        void setPresetTags(const juce::String& presetName, const juce::StringArray& tags);
+
         /**
          * @brief Deletes a preset file from the default directory.
          * @param presetName Name of the preset to delete.
@@ -54,10 +65,19 @@ namespace Service
 
         /**
          * @brief Loads a preset file into the plugin.
+         *
+         * The file is read on a background thread and applied on the message thread once
+         * it is decoded; presets prefetched by prefetchNeighbours() are applied at once.
          * @param presetName Name of the preset to load.
          */
         void loadPreset(const juce::String& presetName);
 
+        /**
+         * @brief Starts decoding the presets before and after the current one in the background,
+         * so that loadNextPreset() and loadPreviousPreset() can apply them without waiting.
+         */
+        void prefetchNeighbours();
+
         /**
          * @brief Loads the next preset in the list of available presets.
          * @return The index of the loaded preset, or -1 if no presets are available.
@@ -72,21 +92,52 @@ namespace Service
 
         /**
          * @brief Gets a list of all available preset names.
-         * @return A StringArray containing the names of all saved presets.
+         * @return A StringArray containing the names of all saved presets, sorted.
          */
         juce::StringArray getAllPresets() const;
 
+        /**
+         * @brief Gets a number that changes whenever the list of presets changes.
+         * @return The version of the shared preset index.
+         */
+        int getPresetListVersion() const noexcept;
+
+        /**
+         * @brief Gets the shared index with names, tags and search terms of every preset.
+         * @return The current snapshot; never nullptr.
+         */
+        std::shared_ptr<const PresetIndex::Snapshot> getPresetSnapshot() const;
+
         /**
          * @brief Gets the name of the currently loaded preset.
          * @return The name of the current preset.
          */
         juce::String getCurrentPreset() const;
 
+        /**
+         * @brief Gets the preset the user chose last: the one still loading, else the current one.
+         * @return The name of the selected preset.
+         */
+        juce::String getSelectedPreset() const;
+
     private:
         /** @brief Called when the underlying ValueTree is redirected. */
         void valueTreeRedirected(juce::ValueTree& treeWhichHasBeenChanged) override;
 
+        /** @brief Loads the preset offset positions away from the current one, wrapping around. */
+        int loadPresetAtOffset(int offset);
+
+        /** @brief Applies a state delivered by the loader. Message thread. */
+        void applyPreset(const juce::String& presetName, juce::ValueTree state);
+
+        /** @brief Drops the loader's decoded presets whose files changed since they were read. */
+        void syncWithIndex();
+
+
         juce::AudioProcessorValueTreeState& apvts; /**< Reference to the plugin's APVTS. */
+        juce::SharedResourcePointer<PresetIndex> presetIndex; /**< Sorted preset names shared by all instances. */
         juce::Value currentPreset; /**< Holds the current preset name as a JUCE Value. */
+        int loaderIndexVersion = -1; /**< Preset index version the loader's cache belongs to. */
+        PresetLoader presetLoader; /**< Reads presets off the message thread and prefetches neighbours. */
     };
 }
@@ -0,0 +1,253 @@
+/*
+  ==============================================================================
+
+    PresetSearch.cpp
+    Created: 19 Oct 2026 3:27:40am
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "PresetSearch.h"
+#include <algorithm>
+#include <array>
+
+namespace Service
+{
+    namespace
+    {
+        constexpr int maxTermLength = 48;   ///< Longer words are compared on their first characters only
+
+        /** A word as code points, so the edit distance can index it directly. */
+        struct Codepoints
+        {
+            std::array<juce::juce_wchar, maxTermLength> chars{};
+            int length = 0;
+
+            Codepoints(const juce::String& text, int maxLength = maxTermLength)
+            {
+                maxLength = juce::jmin(maxLength, maxTermLength);
+                for (auto p = text.getCharPointer(); !p.isEmpty() && length < maxLength; ++p)
+                    chars[(size_t)length++] = *p;
+            }
+        };
+
+        /**
+         * Smallest edit distance between term and any prefix of word, or maxEdits + 1 if
+         * it exceeds maxEdits. Stops as soon as a whole row is over the limit.
+         */
+        int prefixEditDistance(const Codepoints& term, const juce::String& word, int maxEdits)
+        {
+            const Codepoints prefix{ word, term.length + maxEdits };
+
+            std::array<int, maxTermLength + 1> previous{}, current{};
+            for (int j = 0; j <= prefix.length; ++j)
+                previous[(size_t)j] = j;
+
+            for (int i = 1; i <= term.length; ++i)
+            {
+                current[0] = i;
+                int rowMin = i;
+
+                for (int j = 1; j <= prefix.length; ++j)
+                {
+                    const int cost = term.chars[(size_t)i - 1] == prefix.chars[(size_t)j - 1] ? 0 : 1;
+                    current[(size_t)j] = juce::jmin(previous[(size_t)j] + 1, current[(size_t)j - 1] + 1,
+                        previous[(size_t)j - 1] + cost);
+                    rowMin = juce::jmin(rowMin, current[(size_t)j]);
+                }
+
+                if (rowMin > maxEdits)
+                    return maxEdits + 1;
+
+                std::swap(previous, current);
+            }
+
+            return *std::min_element(previous.begin(), previous.begin() + prefix.length + 1);
+        }
+
+        /** @return The range of terms that start with prefix; the terms are sorted. */
+        std::pair<const juce::String*, const juce::String*> findPrefixRange(const juce::StringArray& terms,
+            const juce::String& prefix)
+        {
+            const auto* first = std::lower_bound(terms.begin(), terms.end(), prefix);
+            const auto* last = first;
+
+            while (last != terms.end() && last->startsWith(prefix))
+                ++last;
+
+            return { first, last };
+        }
+    }
+
+    //==============================================================================
+    const std::vector<int>& PresetSearch::search(std::shared_ptr<const PresetIndex::Snapshot> newSnapshot,
+        const juce::String& query)
+    {
+        jassert(newSnapshot != nullptr);
+
+        const auto terms = PresetIndex::splitIntoTerms(query);
+        const int numOld = queryTerms.size();
+        const int numNew = terms.size();
+
+        auto sameLeadingTerms = [&](int count)
+        {
+            for (int i = 0; i < count; ++i)
+                if (terms[i] != queryTerms[i])
+                    return false;
+            return true;
+        };
+
+        const bool sameIndex = newSnapshot == snapshot;
+        snapshot = std::move(newSnapshot);
+
+        // A longer last word or one more word can only narrow the results, as long as the
+        // longer word is not allowed more typing errors than the shorter one
+        if (sameIndex && numOld > 0 && numNew == numOld && sameLeadingTerms(numOld - 1)
+            && terms[numNew - 1].startsWith(queryTerms[numOld - 1])
+            && getMaxEdits(terms[numNew - 1].length()) == getMaxEdits(queryTerms[numOld - 1].length()))
+        {
+            if (terms[numNew - 1] != queryTerms[numOld - 1])
+                refine(terms[numNew - 1], true);
+        }
+        else if (sameIndex && numOld > 0 && numNew == numOld + 1 && sameLeadingTerms(numOld))
+        {
+            refine(terms[numNew - 1], false);
+        }
+        else
+        {
+            queryTerms = terms;
+            searchAll();
+            return results;
+        }
+
+        queryTerms = terms;
+        publishResults();
+        return results;
+    }
+
+    int PresetSearch::getMaxEdits(int termLength) noexcept
+    {
+        return termLength < 4 ? 0 : (termLength < 8 ? 1 : 2);
+    }
+
+    //==============================================================================
+    void PresetSearch::searchAll()
+    {
+        const int numPresets = snapshot->names.size();
+        hits.clear();
+
+        if (queryTerms.isEmpty())
+        {
+            for (int i = 0; i < numPresets; ++i)
+                hits.push_back({ i, 0, false });
+
+            publishResults();
+            return;
+        }
+
+        matchedTerms.assign((size_t)numPresets, 0);
+        fuzzyTerms.assign((size_t)numPresets, 0);
+
+        const auto& terms = snapshot->terms;
+
+        for (const auto& term : queryTerms)
+        {
+            termMatches.assign((size_t)numPresets, Match::none);
+
+            const auto [first, last] = findPrefixRange(terms, term);
+            for (auto* t = first; t != last; ++t)
+                for (const int preset : snapshot->postings[(size_t)(t - terms.begin())])
+                    termMatches[(size_t)preset] = Match::prefix;
+
+            // Fuzzy matches come from the whole vocabulary, which is far smaller than the library
+            if (const int maxEdits = getMaxEdits(term.length()); maxEdits > 0)
+            {
+                const Codepoints codepoints{ term };
+
+                for (int i = 0; i < terms.size(); ++i)
+                {
+                    const auto& candidate = terms.getReference(i);
+
+                    if (candidate.length() < codepoints.length - maxEdits
+                        || prefixEditDistance(codepoints, candidate, maxEdits) > maxEdits)
+                        continue;
+
+                    for (const int preset : snapshot->postings[(size_t)i])
+                        if (termMatches[(size_t)preset] == Match::none)
+                            termMatches[(size_t)preset] = Match::fuzzy;
+                }
+            }
+
+            for (int preset = 0; preset < numPresets; ++preset)
+            {
+                const auto match = termMatches[(size_t)preset];
+                if (match == Match::none)
+                    continue;
+
+                ++matchedTerms[(size_t)preset];
+                fuzzyTerms[(size_t)preset] += match == Match::fuzzy ? 1 : 0;
+            }
+        }
+
+        const int numTerms = queryTerms.size();
+
+        for (int preset = 0; preset < numPresets; ++preset)
+            if (matchedTerms[(size_t)preset] == numTerms)
+                hits.push_back({ preset, fuzzyTerms[(size_t)preset], termMatches[(size_t)preset] == Match::fuzzy });
+
+        publishResults();
+    }
+
+    void PresetSearch::refine(const juce::String& term, bool replacesLastTerm)
+    {
+        size_t kept = 0;
+
+        for (auto hit : hits)
+        {
+            const auto match = matchPreset(hit.preset, term);
+            if (match == Match::none)
+                continue;
+
+            if (replacesLastTerm && hit.lastTermFuzzy)
+                --hit.fuzzyTerms;
+
+            hit.lastTermFuzzy = match == Match::fuzzy;
+            hit.fuzzyTerms += hit.lastTermFuzzy ? 1 : 0;
+            hits[kept++] = hit;
+        }
+
+        hits.resize(kept);
+    }
+
+    PresetSearch::Match PresetSearch::matchPreset(int preset, const juce::String& term) const
+    {
+        const auto& presetTerms = snapshot->presetTerms[(size_t)preset];
+
+        for (const int t : presetTerms)
+            if (snapshot->terms.getReference(t).startsWith(term))
+                return Match::prefix;
+
+        if (const int maxEdits = getMaxEdits(term.length()); maxEdits > 0)
+        {
+            const Codepoints codepoints{ term };
+
+            for (const int t : presetTerms)
+                if (prefixEditDistance(codepoints, snapshot->terms.getReference(t), maxEdits) <= maxEdits)
+                    return Match::fuzzy;
+        }
+
+        return Match::none;
+    }
+
+    void PresetSearch::publishResults()
+    {
+        std::stable_sort(hits.begin(), hits.end(), [](const Hit& a, const Hit& b)
+            {
+                return a.fuzzyTerms != b.fuzzyTerms ? a.fuzzyTerms < b.fuzzyTerms : a.preset < b.preset;
+            });
+
+        results.resize(hits.size());
+        std::transform(hits.begin(), hits.end(), results.begin(), [](const Hit& hit) { return hit.preset; });
+    }
+} // namespace Service
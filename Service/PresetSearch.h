@@ -0,0 +1,85 @@
+/*
+  ==============================================================================
+
+    PresetSearch.h
+    Created: 19 Oct 2026 3:27:40am
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <memory>
+#include <vector>
+#include "PresetIndex.h"
+
+namespace Service
+{
+    /**
+     * @class PresetSearch
+     * @brief Type-to-filter search over a PresetIndex snapshot.
+     *
+     * Every word of the query must match a term of a preset's name or tags, either as a
+     * prefix or, for longer words, within a few typing errors of a prefix. Presets that
+     * need fewer fuzzy matches rank first; ties keep the index's name order. While the
+     * query only grows, e.g. one keystroke at a time, the previous results are refined
+     * instead of searching the whole index again.
+     */
+    class PresetSearch
+    {
+    public:
+        PresetSearch() = default;
+
+        /**
+         * @brief Runs a query.
+         * @param snapshot The index to search; a different snapshot always searches from scratch.
+         * @param query    The text typed so far; empty lists every preset.
+         * @return Preset positions in the snapshot, best match first.
+         */
+        const std::vector<int>& search(std::shared_ptr<const PresetIndex::Snapshot> snapshot, const juce::String& query);
+
+        /** @return The results of the last search. */
+        const std::vector<int>& getResults() const noexcept { return results; }
+
+        /**
+         * @brief Typing errors allowed for a query word.
+         * @param termLength Number of characters in the word.
+         * @return 0 below 4 characters, 1 below 8, else 2.
+         */
+        static int getMaxEdits(int termLength) noexcept;
+
+    private:
+        enum class Match { none, prefix, fuzzy };
+
+        struct Hit
+        {
+            int preset;
+            int fuzzyTerms;       ///< Query words this preset only matches with typing errors
+            bool lastTermFuzzy;   ///< Whether the last query word is one of them
+        };
+
+        /** Searches the whole index for every query word. */
+        void searchAll();
+
+        /** Filters the current hits by a query word that grew or was added. */
+        void refine(const juce::String& term, bool replacesLastTerm);
+
+        /** @return How one query word matches one preset. */
+        Match matchPreset(int preset, const juce::String& term) const;
+
+        /** Sorts the hits by rank and fills results. */
+        void publishResults();
+
+        std::shared_ptr<const PresetIndex::Snapshot> snapshot;
+        juce::StringArray queryTerms;
+        std::vector<Hit> hits;
+        std::vector<int> results;
+        std::vector<int> matchedTerms;          ///< Scratch for searchAll(), per preset
+        std::vector<int> fuzzyTerms;
+        std::vector<Match> termMatches;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PresetSearch)
+    };
+}
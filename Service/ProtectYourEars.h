@@ -10,48 +10,118 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+#include <cstring>
 #include <JuceHeader.h>
 
-// Silences the buffer if bad or loud values are detected in the output buffer.
-// Use this during debugging to avoid blowing out your eardrums on headphones.
-inline void protectYourEars(juce::AudioBuffer<float>& buffer)
+/**
+    Last stage of the output: contains NaN/Inf and runaway levels in release builds too.
+    Non-finite samples silence the block and are reported so the caller can reset its stages,
+    since a NaN in a filter or detector state would otherwise poison every following block.
+    Samples above 0 dBFS are bent by a soft ceiling that never exceeds +6 dBFS.
+    Event counters are written by the audio thread only and can be polled by the GUI.
+*/
+class ProtectYourEars
 {
-    bool firstWarning = true;
-    for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+public:
+    static constexpr float kneeLevel = 1.0f;       ///< 0 dBFS: samples up to here pass untouched
+    static constexpr float ceilingLevel = 2.0f;    ///< +6 dBFS: asymptote of the soft ceiling
+
+    /**
+        Checks and conditions a buffer in place. Real-time safe.
+        @param buffer The output buffer.
+        @return True if non-finite samples were found; the buffer was silenced and the caller
+                should reset the state of its processing stages.
+    */
+    bool process(juce::AudioBuffer<float>& buffer) noexcept
     {
-        float* channelData = buffer.getWritePointer(channel);
-        for (int sample = 0; sample < buffer.getNumSamples(); ++sample)
+        const int numChannels = buffer.getNumChannels();
+        const int numSamples = buffer.getNumSamples();
+
+        std::uint32_t exponentFlags = 0;
+        for (int ch = 0; ch < numChannels; ++ch)
+            exponentFlags |= scanForNonFinite(buffer.getReadPointer(ch), numSamples);
+
+        if ((exponentFlags & nonFiniteBit) != 0)
+        {
+            buffer.clear();
+            increment(nonFiniteEvents);
+            return true;
+        }
+
+        // getMagnitude() runs on FloatVectorOperations, so the common case costs two vector passes
+        float peak = 0.0f;
+        for (int ch = 0; ch < numChannels; ++ch)
+            peak = juce::jmax(peak, buffer.getMagnitude(ch, 0, numSamples));
+
+        if (peak > kneeLevel)
         {
-            float x = channelData[sample];
-            bool silence = false;
-            if (std::isnan(x))
-            {
-                DBG("!!! WARNING: nan detected in audio buffer, silencing !!!");
-                silence = true;
-            }
-            else if (std::isinf(x))
-            {
-                DBG("!!! WARNING: inf detected in audio buffer, silencing !!!");
-                silence = true;
-            }
-            else if (x < -2.0f || x > 2.0f)
-            {  // screaming feedback
-                DBG("!!! WARNING: sample out of range, silencing !!!");
-                silence = true;
-            }
-            else if (x < -1.0f || x > 1.0f)
-            {
-                if (firstWarning)
-                {
-                    DBG("!!! WARNING: sample out of range: " << x << " !!!");
-                    firstWarning = false;
-                }
-            }
-            if (silence)
-            {
-                buffer.clear();
-                return;
-            }
+            for (int ch = 0; ch < numChannels; ++ch)
+                applySoftCeiling(buffer.getWritePointer(ch), numSamples);
+
+            increment(overEvents);
         }
+
+        return false;
     }
-}
\ No newline at end of file
+
+    /// @returns Number of blocks silenced because of NaN or Inf samples.
+    std::uint32_t getNonFiniteEvents() const noexcept { return nonFiniteEvents.load(std::memory_order_relaxed); }
+
+    /// @returns Number of blocks in which the soft ceiling engaged.
+    std::uint32_t getOverEvents() const noexcept { return overEvents.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr std::uint32_t exponentMask = 0x7f800000u;
+    static constexpr std::uint32_t exponentLsb = 0x00800000u;
+    static constexpr std::uint32_t nonFiniteBit = 0x80000000u;
+
+    /**
+        A float is NaN or Inf exactly when its exponent bits are all ones. Adding one exponent LSB
+        to the masked exponent then carries into bit 31, which no finite value can reach, so OR-ing
+        the sums flags the whole channel with integer ops only. The loop has no branches and
+        compiles to a handful of vector instructions per register.
+        @return The OR of all sums; test it against nonFiniteBit.
+    */
+    static std::uint32_t scanForNonFinite(const float* data, int numSamples) noexcept
+    {
+        std::uint32_t flags = 0;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            std::uint32_t bits;
+            std::memcpy(&bits, data + i, sizeof(bits));
+            flags |= (bits & exponentMask) + exponentLsb;
+        }
+
+        return flags;
+    }
+
+    /**
+        Rational soft clip above kneeLevel: unity slope at the knee, approaching ceilingLevel.
+    */
+    static void applySoftCeiling(float* data, int numSamples) noexcept
+    {
+        constexpr float range = ceilingLevel - kneeLevel;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float magnitude = std::abs(data[i]);
+            if (magnitude <= kneeLevel)
+                continue;
+
+            const float over = (magnitude - kneeLevel) / range;
+            data[i] = std::copysign(kneeLevel + range * over / (1.0f + over), data[i]);
+        }
+    }
+
+    /// Single writer, so a plain load/store pair is enough and avoids a locked RMW.
+    static void increment(std::atomic<std::uint32_t>& counter) noexcept
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    std::atomic<std::uint32_t> nonFiniteEvents{ 0 };   ///< Blocks silenced for NaN/Inf
+    std::atomic<std::uint32_t> overEvents{ 0 };        ///< Blocks that hit the soft ceiling
+};
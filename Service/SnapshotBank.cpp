@@ -0,0 +1,188 @@
+/*
+  ==============================================================================
+
+    SnapshotBank.cpp
+    Created: 19 Oct 2026 2:41:09am
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "SnapshotBank.h"
+
+namespace Service
+{
+    SnapshotBank::SnapshotBank(juce::AudioProcessorValueTreeState& apvts)
+    {
+        for (size_t i = 0; i < parameters.size(); ++i)
+        {
+            parameters[i] = apvts.getParameter(snapshotParameterIDs[i].getParamID());
+            jassert(parameters[i] != nullptr);
+        }
+    }
+
+    //==============================================================================
+    void SnapshotBank::selectSlot(int slot)
+    {
+        jassert(juce::isPositiveAndBelow(slot, numSlots));
+        JUCE_ASSERT_MESSAGE_THREAD
+
+        if (slot == activeSlot)
+            return;
+
+        if (activeSlot >= 0)
+            slots[(size_t)activeSlot] = capture();
+
+        if (!stored[(size_t)slot])
+        {
+            slots[(size_t)slot] = capture();
+            stored[(size_t)slot] = true;
+        }
+        else
+        {
+            apply(slots[(size_t)slot]);
+        }
+
+        if (slot != morphTarget)
+        {
+            morphSource = morphTarget;
+            morphTarget = slot;
+        }
+
+        activeSlot = slot;
+    }
+
+    void SnapshotBank::morph(float amount)
+    {
+        JUCE_ASSERT_MESSAGE_THREAD
+
+        if (!stored[(size_t)morphSource] || !stored[(size_t)morphTarget])
+            return;
+
+        // Edits to the active slot are kept before the morph takes over the settings
+        if (activeSlot >= 0)
+            slots[(size_t)activeSlot] = capture();
+
+        const auto& from = slots[(size_t)morphSource];
+        const auto& to = slots[(size_t)morphTarget];
+        amount = juce::jlimit(0.0f, 1.0f, amount);
+
+        SnapshotValues blended;
+
+        for (size_t i = 0; i < blended.size(); ++i)
+        {
+            const auto* parameter = parameters[i];
+
+            // A switch halfway through a morph would jump; it stays as it is
+            if (parameter->isBoolean())
+            {
+                blended[i] = parameter->convertFrom0to1(parameter->getValue());
+                continue;
+            }
+
+            // Blended along the normalised range so skewed parameters such as the low cut move evenly
+            const float start = parameter->convertTo0to1(from[i]);
+            const float end = parameter->convertTo0to1(to[i]);
+            blended[i] = parameter->convertFrom0to1(start + amount * (end - start));
+        }
+
+        activeSlot = -1;
+        apply(blended);
+    }
+
+    void SnapshotBank::beginMorphGesture()
+    {
+        JUCE_ASSERT_MESSAGE_THREAD
+
+        if (morphGestureOpen)
+            return;
+
+        for (auto* parameter : parameters)
+            if (!parameter->isBoolean())
+                parameter->beginChangeGesture();
+
+        morphGestureOpen = true;
+    }
+
+    void SnapshotBank::endMorphGesture()
+    {
+        JUCE_ASSERT_MESSAGE_THREAD
+
+        if (!morphGestureOpen)
+            return;
+
+        for (auto* parameter : parameters)
+            if (!parameter->isBoolean())
+                parameter->endChangeGesture();
+
+        morphGestureOpen = false;
+    }
+
+    juce::String SnapshotBank::getSlotName(int slot)
+    {
+        return juce::String::charToString((juce::juce_wchar)('A' + slot));
+    }
+
+    //==============================================================================
+    /**
+     * @brief Audio thread side of the hand-over.
+     *
+     * A new buffer is taken whenever the message thread marked one fresh. It stays in force
+     * until the message thread reports that the parameters hold the same values, so a block
+     * never mixes old and new settings while the parameter writes are in flight.
+     */
+    const SnapshotValues* SnapshotBank::getHeldTargets() noexcept
+    {
+        if ((shared.load(std::memory_order_relaxed) & freshBit) != 0)
+        {
+            frontIndex = shared.exchange(frontIndex, std::memory_order_acq_rel) & indexMask;
+            held = &buffers[(size_t)frontIndex];
+        }
+
+        if (held != nullptr && writtenGeneration.load(std::memory_order_acquire) - held->generation >= 0)
+            held = nullptr;
+
+        return held != nullptr ? &held->values : nullptr;
+    }
+
+    //==============================================================================
+    SnapshotValues SnapshotBank::capture() const
+    {
+        SnapshotValues values;
+
+        for (size_t i = 0; i < values.size(); ++i)
+            values[i] = parameters[i]->convertFrom0to1(parameters[i]->getValue());
+
+        return values;
+    }
+
+    void SnapshotBank::apply(const SnapshotValues& values)
+    {
+        auto& back = buffers[(size_t)backIndex];
+        back.values = values;
+        back.generation = ++nextGeneration;
+        backIndex = shared.exchange(backIndex | freshBit, std::memory_order_acq_rel) & indexMask;
+
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            auto* parameter = parameters[i];
+            const float normalised = parameter->convertTo0to1(values[i]);
+
+            if (parameter->getValue() == normalised)
+                continue;
+
+            // Inside a morph gesture every blended parameter is already open; switches never change there
+            const bool ownGesture = !morphGestureOpen || parameter->isBoolean();
+
+            if (ownGesture)
+                parameter->beginChangeGesture();
+
+            parameter->setValueNotifyingHost(normalised);
+
+            if (ownGesture)
+                parameter->endChangeGesture();
+        }
+
+        writtenGeneration.store(nextGeneration, std::memory_order_release);
+    }
+} // namespace Service
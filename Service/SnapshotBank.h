@@ -0,0 +1,129 @@
+/*
+  ==============================================================================
+
+    SnapshotBank.h
+    Created: 19 Oct 2026 2:41:09am
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include "Parameters.h"
+
+namespace Service
+{
+    /**
+     * @class SnapshotBank
+     * @brief A/B/C/D comparison slots holding the full parameter set in memory.
+     *
+     * Recalling or morphing publishes the new values to the audio thread through a
+     * lock-free triple buffer, so the audio thread switches all targets in the same block
+     * and ramps them through the existing smoothers. The parameters themselves are then
+     * set as well, so the host and the knobs follow; the audio thread keeps the published
+     * values until those writes have landed. Nothing here allocates or calls
+     * AudioProcessorValueTreeState::replaceState.
+     */
+    class SnapshotBank
+    {
+    public:
+        static constexpr int numSlots = 4;
+
+        /**
+         * @brief Constructs a bank with empty slots.
+         * @param apvts The state holding the parameters listed in snapshotParameterIDs.
+         */
+        explicit SnapshotBank(juce::AudioProcessorValueTreeState& apvts);
+
+        //==============================================================================
+        // Message thread
+
+        /**
+         * @brief Makes a slot the active one.
+         *
+         * Edits made since the active slot was recalled are kept in it first. An empty slot
+         * takes the current settings; a stored one is recalled.
+         * @param slot Index of the slot, 0 for A.
+         */
+        void selectSlot(int slot);
+
+        /**
+         * @brief Blends the two most recently selected slots.
+         * @param amount 0 for the earlier slot, 1 for the later one. Switches keep their current setting.
+         */
+        void morph(float amount);
+
+        /**
+         * @brief Opens one change gesture on every blended parameter for a run of morph() calls,
+         *        e.g. while the morph slider is dragged, so the host records a single edit.
+         */
+        void beginMorphGesture();
+
+        /** @brief Closes the gestures opened by beginMorphGesture(); does nothing if none is open. */
+        void endMorphGesture();
+
+        /** @return The active slot, or -1 while the settings come from a morph. */
+        int getActiveSlot() const noexcept { return activeSlot; }
+
+        /** @return True if a slot holds settings. */
+        bool isStored(int slot) const noexcept { return stored[(size_t)slot]; }
+
+        /** @return The slots morph() blends from and to; equal until two slots were selected. */
+        int getMorphSource() const noexcept { return morphSource; }
+        int getMorphTarget() const noexcept { return morphTarget; }
+
+        /** @return The letter shown for a slot, e.g. "A". */
+        static juce::String getSlotName(int slot);
+
+        //==============================================================================
+        // Audio thread
+
+        /**
+         * @brief Gets the values the audio thread should move towards instead of the parameters.
+         * Call once per block after Parameters::update(). Real-time safe.
+         * @return The published values while their parameter writes are pending, else nullptr.
+         */
+        const SnapshotValues* getHeldTargets() noexcept;
+
+    private:
+        struct Published
+        {
+            SnapshotValues values{};
+            int generation = 0;   ///< Matches writtenGeneration once the parameters hold values
+        };
+
+        /** Reads the current parameter values. */
+        SnapshotValues capture() const;
+
+        /** Sends values to the audio thread, then sets the parameters to them. */
+        void apply(const SnapshotValues& values);
+
+        std::array<juce::RangedAudioParameter*, (size_t)SnapshotParameter::count> parameters{};
+
+        std::array<SnapshotValues, numSlots> slots{};
+        std::array<bool, numSlots> stored{};
+        int activeSlot = -1;
+        int morphSource = 0;
+        int morphTarget = 0;
+        bool morphGestureOpen = false;
+
+        // Triple buffer: the message thread owns backIndex, the audio thread frontIndex,
+        // and the middle one is handed over in shared, tagged with freshBit when it is new.
+        static constexpr int indexMask = 3;
+        static constexpr int freshBit = 4;
+        std::array<Published, 3> buffers{};
+        int backIndex = 0;
+        std::atomic<int> shared{ 1 };
+        int frontIndex = 2;
+
+        int nextGeneration = 0;
+        std::atomic<int> writtenGeneration{ 0 };
+        const Published* held = nullptr;   ///< Audio thread only
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SnapshotBank)
+    };
+}
@@ -0,0 +1,246 @@
+/*
+  ==============================================================================
+
+    SpectrumAnalyzer.cpp
+    Created: 18 Oct 2026 9:58:21pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "SpectrumAnalyzer.h"
+
+//==============================================================================
+SpectrumAnalyzer::SpectrumAnalyzer()
+{
+    for (auto& tap : taps)
+    {
+        for (auto& channel : tap.samples)
+            channel.resize((size_t)TapState::capacity);
+
+        tap.frame.resize((size_t)fftSize);
+        tap.averagedPower.resize((size_t)(fftSize / 2 + 1));
+    }
+
+    window.resize((size_t)fftSize);
+    juce::dsp::WindowingFunction<float>::fillWindowingTables(window.data(), window.size(),
+        juce::dsp::WindowingFunction<float>::hann, false);
+
+    // A sine of amplitude A peaks at A * sum(window) / 2 in the magnitude spectrum
+    float windowSum = 0.0f;
+    for (auto w : window)
+        windowSum += w;
+
+    const float amplitudeScale = 2.0f / windowSum;
+    powerScale = amplitudeScale * amplitudeScale;
+
+    fftData.resize((size_t)(2 * fftSize));
+
+    for (auto& spectrum : published)
+        spectrum.fill(floorDb);
+}
+
+SpectrumAnalyzer::~SpectrumAnalyzer()
+{
+    if (thread != nullptr)
+        thread->removeTimeSliceClient(this);
+}
+
+void SpectrumAnalyzer::prepare(double newSampleRate, juce::TimeSliceThread& analysisThread)
+{
+    if (thread != nullptr)
+        thread->removeTimeSliceClient(this);
+
+    thread = &analysisThread;
+    sampleRate = newSampleRate;
+
+    clearAnalysis();
+    resetRequested.store(false);
+
+    thread->addTimeSliceClient(this);
+}
+
+void SpectrumAnalyzer::setActive(bool shouldBeActive) noexcept
+{
+    // Whatever was queued before a restart is stale
+    if (shouldBeActive && !active.load())
+        resetRequested.store(true, std::memory_order_release);
+
+    active.store(shouldBeActive, std::memory_order_release);
+}
+
+//==============================================================================
+void SpectrumAnalyzer::push(Tap tapIndex, const juce::AudioBuffer<float>& buffer) noexcept
+{
+    if (!active.load(std::memory_order_relaxed))
+        return;
+
+    const int numChannels = buffer.getNumChannels();
+    const int numSamples = buffer.getNumSamples();
+    if (numChannels == 0 || numSamples == 0)
+        return;
+
+    auto& tap = taps[(size_t)tapIndex];
+
+    // Drop the whole block rather than tearing it if the analysis falls behind
+    if (tap.fifo.getFreeSpace() < numSamples)
+        return;
+
+    int start1, size1, start2, size2;
+    tap.fifo.prepareToWrite(numSamples, start1, size1, start2, size2);
+
+    for (int ch = 0; ch < 2; ++ch)
+    {
+        const float* source = buffer.getReadPointer(juce::jmin(ch, numChannels - 1));
+        float* destination = tap.samples[(size_t)ch].data();
+
+        std::memcpy(destination + start1, source, sizeof(float) * (size_t)size1);
+        if (size2 > 0)
+            std::memcpy(destination + start2, source + size1, sizeof(float) * (size_t)size2);
+    }
+
+    tap.fifo.finishedWrite(size1 + size2);
+}
+
+//==============================================================================
+int SpectrumAnalyzer::useTimeSlice()
+{
+    if (resetRequested.exchange(false, std::memory_order_acq_rel))
+        clearAnalysis();
+
+    if (!active.load(std::memory_order_acquire))
+        return idleIntervalMs;
+
+    bool analysed = false;
+    for (auto& tap : taps)
+        analysed |= consume(tap);
+
+    if (analysed)
+    {
+        std::array<Spectrum, numTaps> spectra;
+        for (size_t i = 0; i < taps.size(); ++i)
+            toDisplayPoints(taps[i], spectra[i]);
+
+        {
+            const juce::SpinLock::ScopedLockType lock(publishLock);
+            published = spectra;
+        }
+
+        version.fetch_add(1, std::memory_order_release);
+    }
+
+    return activeIntervalMs;
+}
+
+bool SpectrumAnalyzer::consume(TapState& tap)
+{
+    bool analysed = false;
+
+    while (tap.fifo.getNumReady() > 0)
+    {
+        const int wanted = juce::jmin(tap.fifo.getNumReady(), fftSize - tap.frameFill);
+
+        int start1, size1, start2, size2;
+        tap.fifo.prepareToRead(wanted, start1, size1, start2, size2);
+
+        const float* left = tap.samples[0].data();
+        const float* right = tap.samples[1].data();
+        float* frame = tap.frame.data() + tap.frameFill;
+
+        for (int i = 0; i < size1; ++i)
+            *frame++ = 0.5f * (left[start1 + i] + right[start1 + i]);
+        for (int i = 0; i < size2; ++i)
+            *frame++ = 0.5f * (left[start2 + i] + right[start2 + i]);
+
+        tap.fifo.finishedRead(size1 + size2);
+        tap.frameFill += size1 + size2;
+
+        if (tap.frameFill == fftSize)
+        {
+            analyseFrame(tap);
+            analysed = true;
+
+            // Keep the overlapping part for the next frame
+            std::memmove(tap.frame.data(), tap.frame.data() + hopSize, sizeof(float) * (size_t)(fftSize - hopSize));
+            tap.frameFill = fftSize - hopSize;
+        }
+    }
+
+    return analysed;
+}
+
+void SpectrumAnalyzer::analyseFrame(TapState& tap)
+{
+    for (int i = 0; i < fftSize; ++i)
+        fftData[(size_t)i] = tap.frame[(size_t)i] * window[(size_t)i];
+
+    std::fill(fftData.begin() + fftSize, fftData.end(), 0.0f);
+    fft.performFrequencyOnlyForwardTransform(fftData.data(), true);
+
+    for (size_t bin = 0; bin < tap.averagedPower.size(); ++bin)
+    {
+        const float power = fftData[bin] * fftData[bin] * powerScale;
+        tap.averagedPower[bin] += averagingCoefficient * (power - tap.averagedPower[bin]);
+    }
+}
+
+void SpectrumAnalyzer::toDisplayPoints(const TapState& tap, Spectrum& spectrum) const noexcept
+{
+    const double binWidth = sampleRate / fftSize;
+    const int lastBin = (int)tap.averagedPower.size() - 1;
+
+    for (int point = 0; point < numPoints; ++point)
+    {
+        // Each point covers the band halfway to its neighbours
+        const double lowEdge = getPointFrequency(point) * std::pow(maxFrequency / minFrequency, -0.5 / (numPoints - 1));
+        const double highEdge = getPointFrequency(point) * std::pow(maxFrequency / minFrequency, 0.5 / (numPoints - 1));
+
+        const int firstBin = juce::jlimit(0, lastBin, (int)std::ceil(lowEdge / binWidth));
+        const int endBin = juce::jlimit(0, lastBin, (int)std::floor(highEdge / binWidth));
+
+        float power = 0.0f;
+
+        if (endBin >= firstBin)
+        {
+            // Several bins per point at the top: keep the loudest so narrow peaks stay visible
+            for (int bin = firstBin; bin <= endBin; ++bin)
+                power = juce::jmax(power, tap.averagedPower[(size_t)bin]);
+        }
+        else
+        {
+            // Fewer bins than points at the bottom: interpolate between the neighbours
+            const double position = juce::jlimit(0.0, (double)lastBin, getPointFrequency(point) / binWidth);
+            const int below = juce::jmin((int)position, lastBin - 1);
+            const float fraction = float(position - below);
+            power = tap.averagedPower[(size_t)below]
+                + fraction * (tap.averagedPower[(size_t)below + 1] - tap.averagedPower[(size_t)below]);
+        }
+
+        spectrum[(size_t)point] = juce::jmax(floorDb, 10.0f * std::log10(power + 1.0e-12f));
+    }
+}
+
+void SpectrumAnalyzer::clearAnalysis()
+{
+    for (auto& tap : taps)
+    {
+        int start1, size1, start2, size2;
+        tap.fifo.prepareToRead(tap.fifo.getNumReady(), start1, size1, start2, size2);
+        tap.fifo.finishedRead(size1 + size2);
+
+        tap.frameFill = 0;
+        std::fill(tap.averagedPower.begin(), tap.averagedPower.end(), 0.0f);
+    }
+}
+
+void SpectrumAnalyzer::getSpectra(Spectrum& preSpectrum, Spectrum& postSpectrum) const
+{
+    const juce::SpinLock::ScopedLockType lock(publishLock);
+    preSpectrum = published[pre];
+    postSpectrum = published[post];
+}
+
+float SpectrumAnalyzer::getPointFrequency(int index) noexcept
+{
+    return minFrequency * std::pow(maxFrequency / minFrequency, (float)index / (numPoints - 1));
+}
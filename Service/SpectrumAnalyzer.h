@@ -0,0 +1,137 @@
+/*
+  ==============================================================================
+
+    SpectrumAnalyzer.h
+    Created: 18 Oct 2026 9:58:21pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include <vector>
+
+/**
+    Pre/post spectrum analysis for the editor.
+    The audio thread only copies both taps into lock-free sample FIFOs (a memcpy per channel).
+    A TimeSliceClient on a background thread mixes them to mono, runs a Hann-windowed FFT with
+    75 % overlap, averages the power spectra and resamples them onto log-spaced display points.
+    Nothing runs on either thread while no editor has activated the analyzer.
+*/
+class SpectrumAnalyzer : private juce::TimeSliceClient
+{
+public:
+    static constexpr int fftOrder = 12;                 ///< 4096 points, about 12 Hz per bin at 48 kHz
+    static constexpr int fftSize = 1 << fftOrder;
+    static constexpr int hopSize = fftSize / 4;         ///< 75 % overlap
+    static constexpr int numPoints = 256;               ///< Log-spaced display points
+    static constexpr float minFrequency = 20.0f;
+    static constexpr float maxFrequency = 20000.0f;
+    static constexpr float floorDb = -100.0f;
+
+    enum Tap
+    {
+        pre = 0,    ///< Input, before the chain
+        post,       ///< Final output
+        numTaps
+    };
+
+    using Spectrum = std::array<float, numPoints>;      ///< Levels in dB at the display points
+
+    SpectrumAnalyzer();
+
+    /// Detaches the analysis from the background thread.
+    ~SpectrumAnalyzer() override;
+
+    /**
+        Allocates the FIFOs and registers the analysis with the background thread.
+        Must not be called concurrently with push().
+        @param sampleRate      The processing sample rate in Hz.
+        @param analysisThread  The background thread that runs the FFTs.
+    */
+    void prepare(double sampleRate, juce::TimeSliceThread& analysisThread);
+
+    /**
+        Starts or stops the analysis. Called by the processor whenever the number of visible
+        editors changes.
+        @param shouldBeActive True while at least one editor is visible.
+    */
+    void setActive(bool shouldBeActive) noexcept;
+
+    /**
+        Copies a block into a tap's FIFO. Audio thread; does nothing while inactive.
+        @param tap    pre or post.
+        @param buffer The block; the first two channels are copied.
+    */
+    void push(Tap tap, const juce::AudioBuffer<float>& buffer) noexcept;
+
+    /// @returns A counter that changes whenever new spectra were published.
+    juce::uint32 getVersion() const noexcept { return version.load(std::memory_order_acquire); }
+
+    /**
+        Copies the latest published spectra. Message thread.
+        @param preSpectrum  Receives the input spectrum.
+        @param postSpectrum Receives the output spectrum.
+    */
+    void getSpectra(Spectrum& preSpectrum, Spectrum& postSpectrum) const;
+
+    /// @returns The frequency of display point index in Hz.
+    static float getPointFrequency(int index) noexcept;
+
+private:
+    /// Sample FIFO plus analysis state of one tap.
+    struct TapState
+    {
+        static constexpr int capacity = 4 * fftSize;
+
+        juce::AbstractFifo fifo{ capacity };
+        std::array<std::vector<float>, 2> samples;      ///< FIFO storage for left and right
+
+        std::vector<float> frame;                       ///< Mono analysis window being filled
+        int frameFill = 0;
+        std::vector<float> averagedPower;               ///< Smoothed power per FFT bin
+    };
+
+    //==============================================================================
+    /// Background side: consumes the FIFOs, analyses full frames and publishes.
+    int useTimeSlice() override;
+
+    /// Pulls samples of one tap; returns true if at least one frame was analysed.
+    bool consume(TapState& tap);
+
+    /// Windows, transforms and averages the tap's current frame.
+    void analyseFrame(TapState& tap);
+
+    /// Maps averaged bin powers to the log-spaced display points.
+    void toDisplayPoints(const TapState& tap, Spectrum& spectrum) const noexcept;
+
+    /// Empties the FIFOs and the averages; background thread.
+    void clearAnalysis();
+
+    //==============================================================================
+    std::array<TapState, numTaps> taps;
+    std::atomic<bool> active{ false };
+    std::atomic<bool> resetRequested{ false };
+
+    juce::TimeSliceThread* thread = nullptr;
+    double sampleRate = 44100.0;
+
+    juce::dsp::FFT fft{ fftOrder };
+    std::vector<float> window;
+    std::vector<float> fftData;                         ///< 2 * fftSize work buffer
+    float powerScale = 1.0f;                            ///< Full-scale sine -> 0 dB
+
+    std::array<Spectrum, numTaps> published{};
+    mutable juce::SpinLock publishLock;
+    std::atomic<juce::uint32> version{ 0 };
+
+    static constexpr float averagingCoefficient = 0.3f;  ///< Weight of the newest frame
+    static constexpr int activeIntervalMs = 20;
+    static constexpr int idleIntervalMs = 200;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SpectrumAnalyzer)
+};
@@ -0,0 +1,114 @@
+/*
+  ==============================================================================
+
+    TelemetryRing.h
+    Created: 18 Oct 2026 7:21:05pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <JuceHeader.h>
+
+/**
+    Everything the editor shows about one processed block. Levels are linear.
+*/
+struct TelemetryRecord
+{
+    /// A left/right pair; mono material carries the same value on both sides.
+    struct StereoLevel
+    {
+        float left = 0.0f;
+        float right = 0.0f;
+
+        float getMax() const noexcept { return juce::jmax(left, right); }
+    };
+
+    StereoLevel inputPeak;              ///< After the input gain, before the low cut
+    StereoLevel inputRms;
+    StereoLevel compAOutputRms;
+    StereoLevel compBOutputRms;
+    StereoLevel outputPeak;             ///< After the output gain and limiter
+    StereoLevel outputRms;
+    StereoLevel gainReduction{ 1.0f, 1.0f };   ///< Output of both stages over input, 1 = no reduction
+
+    float compAGainReductionDb = 0.0f;  ///< Larger channel of stage A, positive dB
+    float compBGainReductionDb = 0.0f;  ///< Larger channel of stage B, positive dB
+    float lowCutHz = 0.0f;              ///< Low cut frequency the block was filtered with
+    int numSamples = 0;
+};
+
+/**
+    Wait-free single-producer/single-consumer ring of TelemetryRecords.
+    The audio thread pushes one record per block; the editor drains everything that arrived since
+    its last frame, so no block is lost between polls. Each side only stores its own index and loads
+    the other's, so there are no read-modify-write atomics, and the indices sit on separate cache
+    lines. When the ring is full (no editor is draining) new records are dropped.
+*/
+class TelemetryRing
+{
+public:
+    static constexpr juce::uint32 capacity = 256;   ///< About 1.5 s of 256-sample blocks at 44.1 kHz
+
+    /**
+        Appends a record. Producer (audio thread) only; real-time safe.
+        @param record The block's telemetry.
+        @return False if the ring was full and the record was dropped.
+    */
+    bool push(const TelemetryRecord& record) noexcept
+    {
+        const auto write = writeIndex.load(std::memory_order_relaxed);
+
+        if (write - cachedReadIndex == capacity)
+        {
+            cachedReadIndex = readIndex.load(std::memory_order_acquire);
+            if (write - cachedReadIndex == capacity)
+                return false;
+        }
+
+        records[write & mask] = record;
+        writeIndex.store(write + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+        Hands every pending record to a callback, oldest first. Consumer (message thread) only.
+        @param callback Called as callback(const TelemetryRecord&) for each record.
+        @return The number of records consumed.
+    */
+    template <typename Callback>
+    int drain(Callback&& callback)
+    {
+        const auto read = readIndex.load(std::memory_order_relaxed);
+        const auto write = writeIndex.load(std::memory_order_acquire);
+
+        for (auto i = read; i != write; ++i)
+            callback(records[i & mask]);
+
+        readIndex.store(write, std::memory_order_release);
+        return int(write - read);
+    }
+
+    /**
+        Drops every pending record, e.g. the backlog left while no editor was open. Consumer only.
+    */
+    void discard() noexcept
+    {
+        readIndex.store(writeIndex.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+private:
+    static_assert((capacity & (capacity - 1)) == 0, "capacity must be a power of two");
+    static constexpr juce::uint32 mask = capacity - 1;
+
+    std::array<TelemetryRecord, capacity> records{};
+
+    alignas(64) std::atomic<juce::uint32> writeIndex{ 0 };     ///< Written by the producer
+    juce::uint32 cachedReadIndex = 0;                           ///< Producer's last view of readIndex
+
+    alignas(64) std::atomic<juce::uint32> readIndex{ 0 };      ///< Written by the consumer
+};
@@ -0,0 +1,251 @@
+/*
+  ==============================================================================
+
+    WaveformPyramid.cpp
+    Created: 18 Oct 2026 8:47:13pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "WaveformPyramid.h"
+
+//==============================================================================
+WaveformPyramid::WaveformPyramid()
+{
+    static_assert((numBaseBins >> (numLevels - 1)) >= 2, "the coarsest level needs at least two entries");
+
+    for (int level = 0; level < numLevels; ++level)
+        levels[(size_t)level].resize((size_t)(numBaseBins >> level));
+
+    fifoData.resize((size_t)fifoSize);
+}
+
+WaveformPyramid::~WaveformPyramid()
+{
+    if (thread != nullptr)
+        thread->removeTimeSliceClient(this);
+}
+
+void WaveformPyramid::prepare(double sampleRate, int maxBlockSize, juce::TimeSliceThread& builderThread)
+{
+    if (thread != nullptr)
+        thread->removeTimeSliceClient(this);
+
+    thread = &builderThread;
+
+    binSamples = juce::jmax(1, juce::roundToInt(sampleRate * binSeconds));
+    stagedInputs.assign((size_t)(maxBlockSize / binSamples + 2), Range{});
+
+    inputPosition = 0;
+    outputPosition = 0;
+    openInput = {};
+    openOutput = {};
+    numStagedInputs = 0;
+    fifo.reset();
+    resetRequested.store(false);
+
+    {
+        const juce::SpinLock::ScopedLockType lock(pyramidLock);
+
+        for (auto& level : levels)
+            std::fill(level.begin(), level.end(), Column{});
+
+        numBins = 0;
+    }
+
+    thread->addTimeSliceClient(this);
+}
+
+void WaveformPyramid::reset() noexcept
+{
+    inputPosition = 0;
+    outputPosition = 0;
+    openInput = {};
+    openOutput = {};
+    numStagedInputs = 0;
+
+    resetRequested.store(true, std::memory_order_release);
+}
+
+//==============================================================================
+WaveformPyramid::Range WaveformPyramid::measure(const juce::AudioBuffer<float>& buffer, int start, int numSamples) noexcept
+{
+    Range range;
+
+    for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+    {
+        const auto minMax = juce::FloatVectorOperations::findMinAndMax(buffer.getReadPointer(ch, start), numSamples);
+        range.min = juce::jmin(range.min, minMax.getStart());
+        range.max = juce::jmax(range.max, minMax.getEnd());
+    }
+
+    return range;
+}
+
+void WaveformPyramid::pushInput(const juce::AudioBuffer<float>& buffer) noexcept
+{
+    const int numSamples = buffer.getNumSamples();
+    numStagedInputs = 0;
+
+    for (int start = 0; start < numSamples;)
+    {
+        const int length = juce::jmin(binSamples - inputPosition, numSamples - start);
+        openInput.extend(measure(buffer, start, length));
+
+        start += length;
+        inputPosition += length;
+
+        if (inputPosition == binSamples)
+        {
+            if (numStagedInputs < (int)stagedInputs.size())
+                stagedInputs[(size_t)numStagedInputs++] = openInput;
+
+            openInput = {};
+            inputPosition = 0;
+        }
+    }
+}
+
+void WaveformPyramid::pushOutput(const juce::AudioBuffer<float>& buffer) noexcept
+{
+    const int numSamples = buffer.getNumSamples();
+    int numCompleted = 0;
+
+    for (int start = 0; start < numSamples;)
+    {
+        const int length = juce::jmin(binSamples - outputPosition, numSamples - start);
+        openOutput.extend(measure(buffer, start, length));
+
+        start += length;
+        outputPosition += length;
+
+        if (outputPosition == binSamples)
+        {
+            // Both sides see the same block lengths, so their bins close in lockstep
+            Column bin;
+            bin.output = openOutput;
+            if (numCompleted < numStagedInputs)
+                bin.input = stagedInputs[(size_t)numCompleted];
+            ++numCompleted;
+
+            int start1, size1, start2, size2;
+            fifo.prepareToWrite(1, start1, size1, start2, size2);
+            if (size1 > 0)
+            {
+                fifoData[(size_t)start1] = bin;
+                fifo.finishedWrite(1);
+            }
+
+            openOutput = {};
+            outputPosition = 0;
+        }
+    }
+
+    numStagedInputs = 0;
+}
+
+//==============================================================================
+int WaveformPyramid::useTimeSlice()
+{
+    if (resetRequested.exchange(false, std::memory_order_acq_rel))
+    {
+        // Bins queued before the reset belong to the old history
+        int start1, size1, start2, size2;
+        fifo.prepareToRead(fifo.getNumReady(), start1, size1, start2, size2);
+        fifo.finishedRead(size1 + size2);
+
+        const juce::SpinLock::ScopedLockType lock(pyramidLock);
+
+        for (auto& level : levels)
+            std::fill(level.begin(), level.end(), Column{});
+
+        numBins = 0;
+    }
+
+    const int numReady = fifo.getNumReady();
+    if (numReady == 0)
+        return pollIntervalMs;
+
+    int start1, size1, start2, size2;
+    fifo.prepareToRead(numReady, start1, size1, start2, size2);
+
+    {
+        const juce::SpinLock::ScopedLockType lock(pyramidLock);
+
+        for (int i = 0; i < size1; ++i)
+            addBin(fifoData[(size_t)(start1 + i)]);
+        for (int i = 0; i < size2; ++i)
+            addBin(fifoData[(size_t)(start2 + i)]);
+    }
+
+    fifo.finishedRead(size1 + size2);
+    return pollIntervalMs;
+}
+
+void WaveformPyramid::addBin(const Column& bin) noexcept
+{
+    const auto index = numBins;
+    levels[0][(size_t)(index & (numBaseBins - 1))] = bin;
+
+    // Each level combines two children; a right child that has not arrived yet is left out
+    for (int level = 1; level < numLevels; ++level)
+    {
+        const auto& children = levels[(size_t)level - 1];
+        const auto childMask = (juce::int64)children.size() - 1;
+
+        const auto entry = index >> level;
+        const auto leftChild = entry * 2;
+        const auto newestChild = index >> (level - 1);
+
+        Column combined = children[(size_t)(leftChild & childMask)];
+        if (leftChild + 1 <= newestChild)
+            combined.extend(children[(size_t)((leftChild + 1) & childMask)]);
+
+        auto& parents = levels[(size_t)level];
+        parents[(size_t)(entry & ((juce::int64)parents.size() - 1))] = combined;
+    }
+
+    numBins = index + 1;
+}
+
+void WaveformPyramid::render(double windowSeconds, std::vector<Column>& columns) const
+{
+    const int numColumns = (int)columns.size();
+    if (numColumns == 0)
+        return;
+
+    std::fill(columns.begin(), columns.end(), Column{});
+
+    const double windowBins = juce::jlimit(1.0, maxWindowSeconds, windowSeconds) / binSeconds;
+    const double binsPerColumn = windowBins / numColumns;
+
+    // The coarsest level whose entries still fit inside one column
+    int level = 0;
+    while (level + 1 < numLevels && (double)(1 << (level + 1)) <= binsPerColumn)
+        ++level;
+
+    const juce::SpinLock::ScopedLockType lock(pyramidLock);
+
+    const auto newest = numBins;
+    const auto oldest = juce::jmax((juce::int64)0, newest - numBaseBins);
+    const double windowStart = (double)newest - windowBins;
+
+    const auto& entries = levels[(size_t)level];
+    const auto entryMask = (juce::int64)entries.size() - 1;
+
+    for (int x = 0; x < numColumns; ++x)
+    {
+        auto first = (juce::int64)std::floor(windowStart + x * binsPerColumn);
+        auto last = juce::jmax(first + 1, (juce::int64)std::floor(windowStart + (x + 1) * binsPerColumn));
+
+        first = juce::jmax(first, oldest);
+        last = juce::jmin(last, newest);
+        if (first >= last)
+            continue;
+
+        auto& column = columns[(size_t)x];
+        for (auto entry = first >> level; entry <= (last - 1) >> level; ++entry)
+            column.extend(entries[(size_t)(entry & entryMask)]);
+    }
+}
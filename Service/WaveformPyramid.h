@@ -0,0 +1,142 @@
+/*
+  ==============================================================================
+
+    WaveformPyramid.h
+    Created: 18 Oct 2026 8:47:13pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include <limits>
+#include <vector>
+
+/**
+    Input/output waveform history for the overview display.
+    The audio thread reduces both signals to min/max pairs over fixed 5 ms bins, so the history
+    has the same time resolution at every sample rate and block size, and hands them over through
+    a lock-free FIFO. A TimeSliceClient on a background thread files each pair into a min/max
+    mipmap: level l holds the extremes of 2^l consecutive bins. render() picks the level whose
+    entries are just narrower than a pixel, so any zoom costs O(pixels) regardless of window length.
+*/
+class WaveformPyramid : private juce::TimeSliceClient
+{
+public:
+    /// Extremes of a stretch of audio over all channels. Empty while min > max.
+    struct Range
+    {
+        float min = std::numeric_limits<float>::max();
+        float max = std::numeric_limits<float>::lowest();
+
+        bool isEmpty() const noexcept { return min > max; }
+
+        void extend(const Range& other) noexcept
+        {
+            min = juce::jmin(min, other.min);
+            max = juce::jmax(max, other.max);
+        }
+
+        bool operator==(const Range& other) const noexcept { return min == other.min && max == other.max; }
+    };
+
+    /// One bin, or one display column, of both signals.
+    struct Column
+    {
+        Range input;
+        Range output;
+
+        void extend(const Column& other) noexcept
+        {
+            input.extend(other.input);
+            output.extend(other.output);
+        }
+
+        bool operator==(const Column& other) const noexcept { return input == other.input && output == other.output; }
+    };
+
+    static constexpr double binSeconds = 0.005;     ///< Duration of one base bin
+    static constexpr int numBaseBins = 8192;        ///< About 41 s of history
+    static constexpr int numLevels = 12;            ///< Coarsest level: 2048 bins (~10 s) per entry
+    static constexpr double maxWindowSeconds = 30.0;
+
+    /// Constructs an unprepared pyramid. Call prepare() before pushing audio.
+    WaveformPyramid();
+
+    /// Detaches the builder from the background thread.
+    ~WaveformPyramid() override;
+
+    /**
+        Sizes the bins for the sample rate, clears the history and registers the builder.
+        Must not be called concurrently with pushInput()/pushOutput().
+        @param sampleRate     The processing sample rate in Hz.
+        @param maxBlockSize   The largest block passed to pushInput()/pushOutput().
+        @param builderThread  The background thread that maintains the pyramid.
+    */
+    void prepare(double sampleRate, int maxBlockSize, juce::TimeSliceThread& builderThread);
+
+    /**
+        Starts a new history: clears the open bins on the calling (audio) thread and asks the
+        builder to drop everything filed so far. Used when recording resumes after a pause.
+    */
+    void reset() noexcept;
+
+    /**
+        Reduces a block of input. Call on the audio thread before the chain overwrites it.
+        @param buffer The unprocessed block.
+    */
+    void pushInput(const juce::AudioBuffer<float>& buffer) noexcept;
+
+    /**
+        Reduces the same block after processing and queues the finished bins. Real-time safe.
+        @param buffer The processed block; must have the length given to pushInput().
+    */
+    void pushOutput(const juce::AudioBuffer<float>& buffer) noexcept;
+
+    /**
+        Fills display columns for the newest windowSeconds of history. Message thread.
+        @param windowSeconds Length of the window, up to maxWindowSeconds.
+        @param columns       Destination, one entry per pixel; columns without data are empty.
+    */
+    void render(double windowSeconds, std::vector<Column>& columns) const;
+
+private:
+    //==============================================================================
+    /// Background side: drains the FIFO into the pyramid.
+    int useTimeSlice() override;
+
+    /// Stores base bin numBins and refreshes the entries above it.
+    void addBin(const Column& bin) noexcept;
+
+    /// Reduces a stretch of all channels of buffer.
+    static Range measure(const juce::AudioBuffer<float>& buffer, int start, int numSamples) noexcept;
+
+    //==============================================================================
+    // Audio thread
+    int binSamples = 220;
+    int inputPosition = 0;              ///< Samples in the open input bin
+    int outputPosition = 0;             ///< Samples in the open output bin
+    Range openInput;
+    Range openOutput;
+    std::vector<Range> stagedInputs;    ///< Input bins completed by the current block
+    int numStagedInputs = 0;
+
+    static constexpr int fifoSize = 2048;
+    juce::AbstractFifo fifo{ fifoSize };
+    std::vector<Column> fifoData;
+    std::atomic<bool> resetRequested{ false };
+
+    // Background thread, read by render() under the lock
+    juce::TimeSliceThread* thread = nullptr;
+    std::array<std::vector<Column>, numLevels> levels;
+    juce::int64 numBins = 0;            ///< Base bins written so far
+    mutable juce::SpinLock pyramidLock;
+
+    static constexpr int pollIntervalMs = 30;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WaveformPyramid)
+};
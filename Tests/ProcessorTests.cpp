@@ -0,0 +1,99 @@
+/*
+  ==============================================================================
+
+    ProcessorTests.cpp
+    Created: 19 Oct 2026 10:02:51am
+    Author:  kyleb
+
+    juce::UnitTest cases for the processor. Build them into a JUCE console
+    application that compiles all plugin sources next to this file, with the
+    same JucePlugin_* settings as the plugin, and call
+    juce::UnitTestRunner().runTestsInCategory("GuideLinesComp").
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../PluginProcessor.h"
+
+namespace
+{
+    constexpr double testSampleRate = 48000.0;
+    constexpr int blockSize = 512;
+
+    class DualMonoTests : public juce::UnitTest
+    {
+    public:
+        DualMonoTests() : juce::UnitTest("Dual mono", "GuideLinesComp") {}
+
+        void runTest() override
+        {
+            beginTest("Stereo material followed by silence keeps its right channel");
+            {
+                // Linear phase delays by half its 85 ms kernel plus one partition (about 48 ms here),
+                // so a left tail copied to the right would show
+                GuideLinesCompAudioProcessor processor;
+                setParameter(processor, lowCutLinearPhaseParamID, 1.0f);
+                prepare(processor, 2);
+
+                juce::Random random{ 1234 };
+                juce::AudioBuffer<float> buffer{ 2, blockSize };
+                juce::MidiBuffer midi;
+
+                // Left carries noise, right is silent; once the input goes silent both channels are
+                // identical, and the right output must still only be the right channel's own (silent) tail
+                for (int b = 0; b < 40; ++b)
+                {
+                    buffer.clear();
+
+                    if (b < 20)
+                        for (int i = 0; i < blockSize; ++i)
+                            buffer.setSample(0, i, random.nextFloat() - 0.5f);
+
+                    processor.processBlock(buffer, midi);
+
+                    expectEquals(buffer.getMagnitude(1, 0, blockSize), 0.0f,
+                        "Right output of block " + juce::String(b) + " is not silent");
+                }
+            }
+
+            beginTest("Mono input is processed once and fills both outputs");
+            {
+                GuideLinesCompAudioProcessor processor;
+                prepare(processor, 1);
+
+                juce::Random random{ 1234 };
+                juce::AudioBuffer<float> buffer{ 2, blockSize };
+                juce::MidiBuffer midi;
+
+                for (int b = 0; b < 10; ++b)
+                {
+                    buffer.clear();
+                    for (int i = 0; i < blockSize; ++i)
+                        buffer.setSample(0, i, random.nextFloat() - 0.5f);
+
+                    processor.processBlock(buffer, midi);
+
+                    for (int i = 0; i < blockSize; ++i)
+                        expectEquals(buffer.getSample(1, i), buffer.getSample(0, i));
+                }
+            }
+        }
+
+    private:
+        static void setParameter(GuideLinesCompAudioProcessor& processor, const juce::ParameterID& id, float value)
+        {
+            auto* parameter = processor.apvts.getParameter(id.getParamID());
+            jassert(parameter != nullptr);
+            parameter->setValueNotifyingHost(value);
+        }
+
+        static void prepare(GuideLinesCompAudioProcessor& processor, int numInputChannels)
+        {
+            processor.setPlayConfigDetails(numInputChannels, 2, testSampleRate, blockSize);
+            processor.prepareToPlay(testSampleRate, blockSize);
+        }
+    };
+
+    static DualMonoTests dualMonoTests;
+}